@@ -11,6 +11,8 @@
 #include "Krpc_Application.h"
 #include "../user.pb.h"
 #include "Krpc_Controller.h"
+#include "Krpc_Pipeline.h"
+#include "Krpc_Batch.h"
 #include <iostream>
 #include <atomic>
 #include <thread>
@@ -51,6 +53,86 @@ void send_request(int thread_id, std::atomic<int> &success_count, std::atomic<in
     }
 }
 
+/**
+ * @brief 异步扇出调用示例：在一个线程中同时发起多个 RPC 请求，再统一等待结果，不需要为每个请求创建线程
+ */
+void send_requests_async(int request_count) {
+    KrpcChannel channel(false);
+
+    Kuser::LoginRequest request;
+    request.set_name("leo");
+    request.set_pwd("123456");
+
+    // 发起全部请求，CallAsync 在请求发出后立即返回
+    std::vector<KrpcFuture<Kuser::LoginResponse>> futures;
+    for(int i = 0; i < request_count; i++){
+        futures.push_back(channel.CallAsync(&Kuser::UserServiceRpc_Stub::Login, request));
+    }
+
+    // 等待所有请求完成
+    int success = 0;
+    for(auto &future : futures){
+        if(!future.Failed() && 0 == future.get().result().errcode()) {
+            success++;
+        }
+    }
+    LOG(INFO) << "Async fan-out success: " << success << " / " << request_count;
+}
+
+/**
+ * @brief 流水线调用示例：攒够一批请求再一起发送，同一连接上的请求帧只需一次系统调用
+ */
+void send_requests_pipelined(int request_count) {
+    KrpcChannel channel(false);
+    // 每攒够 64 个请求自动发送一次
+    KrpcPipeline pipeline(&channel, 64);
+
+    Kuser::LoginRequest request;
+    request.set_name("leo");
+    request.set_pwd("123456");
+
+    std::vector<KrpcFuture<Kuser::LoginResponse>> futures;
+    for(int i = 0; i < request_count; i++){
+        futures.push_back(pipeline.CallAsync(&Kuser::UserServiceRpc_Stub::Login, request));
+    }
+    // 发送最后不足一批的请求
+    pipeline.Flush();
+
+    int success = 0;
+    for(auto &future : futures){
+        if(!future.Failed() && 0 == future.get().result().errcode()) {
+            success++;
+        }
+    }
+    LOG(INFO) << "Pipelined call success: " << success << " / " << request_count;
+}
+
+/**
+ * @brief 批量调用示例：多个调用打包进一个请求帧，服务端用一个响应帧带回所有结果
+ */
+void send_requests_batched(int request_count) {
+    KrpcChannel channel(false);
+    KrpcBatch batch(&channel);
+
+    Kuser::LoginRequest request;
+    request.set_name("leo");
+    request.set_pwd("123456");
+
+    std::vector<KrpcFuture<Kuser::LoginResponse>> futures;
+    for(int i = 0; i < request_count; i++){
+        futures.push_back(batch.CallAsync(&Kuser::UserServiceRpc_Stub::Login, request));
+    }
+    batch.Send();
+
+    int success = 0;
+    for(auto &future : futures){
+        if(!future.Failed() && 0 == future.get().result().errcode()) {
+            success++;
+        }
+    }
+    LOG(INFO) << "Batched call success: " << success << " / " << request_count;
+}
+
 int main(int argc, char **argv) {
     // 初始化 RPC 框架，解析命令行参数 并加载配置文件
     KrpcApplication::Init(argc, argv);
@@ -94,5 +176,14 @@ int main(int argc, char **argv) {
     LOG(INFO) << "Elapsed time: " << elapsed.count() << " seconds"; // 耗时
     LOG(INFO) << "QPS: " << (thread_count * request_per_thread) / elapsed.count(); // // 计算 QPS（每秒请求数）
 
+    // 异步扇出调用
+    send_requests_async(20);
+
+    // 流水线批量调用
+    send_requests_pipelined(200);
+
+    // 批量调用
+    send_requests_batched(50);
+
     return 0;
 }
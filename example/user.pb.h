@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -44,32 +42,24 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_user_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[5]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_user_2eproto;
 namespace Kuser {
 class LoginRequest;
-class LoginRequestDefaultTypeInternal;
+struct LoginRequestDefaultTypeInternal;
 extern LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
 class LoginResponse;
-class LoginResponseDefaultTypeInternal;
+struct LoginResponseDefaultTypeInternal;
 extern LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
 class RegisterRequest;
-class RegisterRequestDefaultTypeInternal;
+struct RegisterRequestDefaultTypeInternal;
 extern RegisterRequestDefaultTypeInternal _RegisterRequest_default_instance_;
 class RegisterResponse;
-class RegisterResponseDefaultTypeInternal;
+struct RegisterResponseDefaultTypeInternal;
 extern RegisterResponseDefaultTypeInternal _RegisterResponse_default_instance_;
 class ResultCode;
-class ResultCodeDefaultTypeInternal;
+struct ResultCodeDefaultTypeInternal;
 extern ResultCodeDefaultTypeInternal _ResultCode_default_instance_;
 }  // namespace Kuser
 PROTOBUF_NAMESPACE_OPEN
@@ -83,11 +73,12 @@ namespace Kuser {
 
 // ===================================================================
 
-class ResultCode PROTOBUF_FINAL :
+class ResultCode final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Kuser.ResultCode) */ {
  public:
-  inline ResultCode() : ResultCode(nullptr) {};
-  virtual ~ResultCode();
+  inline ResultCode() : ResultCode(nullptr) {}
+  ~ResultCode() override;
+  explicit PROTOBUF_CONSTEXPR ResultCode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ResultCode(const ResultCode& from);
   ResultCode(ResultCode&& from) noexcept
@@ -100,8 +91,13 @@ class ResultCode PROTOBUF_FINAL :
     return *this;
   }
   inline ResultCode& operator=(ResultCode&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -112,14 +108,14 @@ class ResultCode PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResultCode& default_instance() {
+    return *internal_default_instance();
   }
-  static const ResultCode& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ResultCode* internal_default_instance() {
     return reinterpret_cast<const ResultCode*>(
                &_ResultCode_default_instance_);
@@ -132,7 +128,12 @@ class ResultCode PROTOBUF_FINAL :
   }
   inline void Swap(ResultCode* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -140,56 +141,53 @@ class ResultCode PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ResultCode* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ResultCode* New() const final {
-    return CreateMaybeMessage<ResultCode>(nullptr);
-  }
-
-  ResultCode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ResultCode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ResultCode>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ResultCode& from);
-  void MergeFrom(const ResultCode& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResultCode& from) {
+    ResultCode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ResultCode* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Kuser.ResultCode";
   }
   protected:
-  explicit ResultCode(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ResultCode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_user_2eproto);
-    return ::descriptor_table_user_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -202,35 +200,24 @@ class ResultCode PROTOBUF_FINAL :
   // bytes errmsg = 2;
   void clear_errmsg();
   const std::string& errmsg() const;
-  void set_errmsg(const std::string& value);
-  void set_errmsg(std::string&& value);
-  void set_errmsg(const char* value);
-  void set_errmsg(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_errmsg(ArgT0&& arg0, ArgT... args);
   std::string* mutable_errmsg();
-  std::string* release_errmsg();
+  PROTOBUF_NODISCARD std::string* release_errmsg();
   void set_allocated_errmsg(std::string* errmsg);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_errmsg();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_errmsg(
-      std::string* errmsg);
   private:
   const std::string& _internal_errmsg() const;
-  void _internal_set_errmsg(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_errmsg(const std::string& value);
   std::string* _internal_mutable_errmsg();
   public:
 
   // int32 errcode = 1;
   void clear_errcode();
-  ::PROTOBUF_NAMESPACE_ID::int32 errcode() const;
-  void set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t errcode() const;
+  void set_errcode(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_errcode() const;
-  void _internal_set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_errcode() const;
+  void _internal_set_errcode(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Kuser.ResultCode)
@@ -240,18 +227,22 @@ class ResultCode PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errmsg_;
-  ::PROTOBUF_NAMESPACE_ID::int32 errcode_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errmsg_;
+    int32_t errcode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_user_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginRequest PROTOBUF_FINAL :
+class LoginRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Kuser.LoginRequest) */ {
  public:
-  inline LoginRequest() : LoginRequest(nullptr) {};
-  virtual ~LoginRequest();
+  inline LoginRequest() : LoginRequest(nullptr) {}
+  ~LoginRequest() override;
+  explicit PROTOBUF_CONSTEXPR LoginRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginRequest(const LoginRequest& from);
   LoginRequest(LoginRequest&& from) noexcept
@@ -264,8 +255,13 @@ class LoginRequest PROTOBUF_FINAL :
     return *this;
   }
   inline LoginRequest& operator=(LoginRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -276,14 +272,14 @@ class LoginRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const LoginRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const LoginRequest* internal_default_instance() {
     return reinterpret_cast<const LoginRequest*>(
                &_LoginRequest_default_instance_);
@@ -296,7 +292,12 @@ class LoginRequest PROTOBUF_FINAL :
   }
   inline void Swap(LoginRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -304,56 +305,53 @@ class LoginRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(LoginRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LoginRequest* New() const final {
-    return CreateMaybeMessage<LoginRequest>(nullptr);
-  }
-
-  LoginRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  LoginRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginRequest& from);
-  void MergeFrom(const LoginRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginRequest& from) {
+    LoginRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Kuser.LoginRequest";
   }
   protected:
-  explicit LoginRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit LoginRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_user_2eproto);
-    return ::descriptor_table_user_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -366,50 +364,28 @@ class LoginRequest PROTOBUF_FINAL :
   // bytes name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_name(
-      std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
   // bytes pwd = 2;
   void clear_pwd();
   const std::string& pwd() const;
-  void set_pwd(const std::string& value);
-  void set_pwd(std::string&& value);
-  void set_pwd(const char* value);
-  void set_pwd(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwd(ArgT0&& arg0, ArgT... args);
   std::string* mutable_pwd();
-  std::string* release_pwd();
+  PROTOBUF_NODISCARD std::string* release_pwd();
   void set_allocated_pwd(std::string* pwd);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_pwd();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_pwd(
-      std::string* pwd);
   private:
   const std::string& _internal_pwd() const;
-  void _internal_set_pwd(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwd(const std::string& value);
   std::string* _internal_mutable_pwd();
   public:
 
@@ -420,18 +396,22 @@ class LoginRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_user_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginResponse PROTOBUF_FINAL :
+class LoginResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Kuser.LoginResponse) */ {
  public:
-  inline LoginResponse() : LoginResponse(nullptr) {};
-  virtual ~LoginResponse();
+  inline LoginResponse() : LoginResponse(nullptr) {}
+  ~LoginResponse() override;
+  explicit PROTOBUF_CONSTEXPR LoginResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginResponse(const LoginResponse& from);
   LoginResponse(LoginResponse&& from) noexcept
@@ -444,8 +424,13 @@ class LoginResponse PROTOBUF_FINAL :
     return *this;
   }
   inline LoginResponse& operator=(LoginResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -456,14 +441,14 @@ class LoginResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const LoginResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const LoginResponse* internal_default_instance() {
     return reinterpret_cast<const LoginResponse*>(
                &_LoginResponse_default_instance_);
@@ -476,7 +461,12 @@ class LoginResponse PROTOBUF_FINAL :
   }
   inline void Swap(LoginResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -484,56 +474,53 @@ class LoginResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(LoginResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LoginResponse* New() const final {
-    return CreateMaybeMessage<LoginResponse>(nullptr);
-  }
-
-  LoginResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  LoginResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginResponse& from);
-  void MergeFrom(const LoginResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginResponse& from) {
+    LoginResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Kuser.LoginResponse";
   }
   protected:
-  explicit LoginResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit LoginResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_user_2eproto);
-    return ::descriptor_table_user_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -550,7 +537,7 @@ class LoginResponse PROTOBUF_FINAL :
   public:
   void clear_result();
   const ::Kuser::ResultCode& result() const;
-  ::Kuser::ResultCode* release_result();
+  PROTOBUF_NODISCARD ::Kuser::ResultCode* release_result();
   ::Kuser::ResultCode* mutable_result();
   void set_allocated_result(::Kuser::ResultCode* result);
   private:
@@ -577,18 +564,22 @@ class LoginResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::Kuser::ResultCode* result_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::Kuser::ResultCode* result_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_user_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RegisterRequest PROTOBUF_FINAL :
+class RegisterRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Kuser.RegisterRequest) */ {
  public:
-  inline RegisterRequest() : RegisterRequest(nullptr) {};
-  virtual ~RegisterRequest();
+  inline RegisterRequest() : RegisterRequest(nullptr) {}
+  ~RegisterRequest() override;
+  explicit PROTOBUF_CONSTEXPR RegisterRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RegisterRequest(const RegisterRequest& from);
   RegisterRequest(RegisterRequest&& from) noexcept
@@ -601,8 +592,13 @@ class RegisterRequest PROTOBUF_FINAL :
     return *this;
   }
   inline RegisterRequest& operator=(RegisterRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -613,14 +609,14 @@ class RegisterRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const RegisterRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RegisterRequest* internal_default_instance() {
     return reinterpret_cast<const RegisterRequest*>(
                &_RegisterRequest_default_instance_);
@@ -633,7 +629,12 @@ class RegisterRequest PROTOBUF_FINAL :
   }
   inline void Swap(RegisterRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -641,56 +642,53 @@ class RegisterRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RegisterRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RegisterRequest* New() const final {
-    return CreateMaybeMessage<RegisterRequest>(nullptr);
-  }
-
-  RegisterRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RegisterRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RegisterRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RegisterRequest& from);
-  void MergeFrom(const RegisterRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterRequest& from) {
+    RegisterRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RegisterRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Kuser.RegisterRequest";
   }
   protected:
-  explicit RegisterRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RegisterRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_user_2eproto);
-    return ::descriptor_table_user_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -704,60 +702,38 @@ class RegisterRequest PROTOBUF_FINAL :
   // bytes name = 2;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_name(
-      std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
   // bytes pwd = 3;
   void clear_pwd();
   const std::string& pwd() const;
-  void set_pwd(const std::string& value);
-  void set_pwd(std::string&& value);
-  void set_pwd(const char* value);
-  void set_pwd(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwd(ArgT0&& arg0, ArgT... args);
   std::string* mutable_pwd();
-  std::string* release_pwd();
+  PROTOBUF_NODISCARD std::string* release_pwd();
   void set_allocated_pwd(std::string* pwd);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_pwd();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_pwd(
-      std::string* pwd);
   private:
   const std::string& _internal_pwd() const;
-  void _internal_set_pwd(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwd(const std::string& value);
   std::string* _internal_mutable_pwd();
   public:
 
   // uint32 id = 1;
   void clear_id();
-  ::PROTOBUF_NAMESPACE_ID::uint32 id() const;
-  void set_id(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t id() const;
+  void set_id(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_id() const;
-  void _internal_set_id(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Kuser.RegisterRequest)
@@ -767,19 +743,23 @@ class RegisterRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_user_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RegisterResponse PROTOBUF_FINAL :
+class RegisterResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Kuser.RegisterResponse) */ {
  public:
-  inline RegisterResponse() : RegisterResponse(nullptr) {};
-  virtual ~RegisterResponse();
+  inline RegisterResponse() : RegisterResponse(nullptr) {}
+  ~RegisterResponse() override;
+  explicit PROTOBUF_CONSTEXPR RegisterResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RegisterResponse(const RegisterResponse& from);
   RegisterResponse(RegisterResponse&& from) noexcept
@@ -792,8 +772,13 @@ class RegisterResponse PROTOBUF_FINAL :
     return *this;
   }
   inline RegisterResponse& operator=(RegisterResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -804,14 +789,14 @@ class RegisterResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const RegisterResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RegisterResponse* internal_default_instance() {
     return reinterpret_cast<const RegisterResponse*>(
                &_RegisterResponse_default_instance_);
@@ -824,7 +809,12 @@ class RegisterResponse PROTOBUF_FINAL :
   }
   inline void Swap(RegisterResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -832,56 +822,53 @@ class RegisterResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RegisterResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RegisterResponse* New() const final {
-    return CreateMaybeMessage<RegisterResponse>(nullptr);
-  }
-
-  RegisterResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RegisterResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RegisterResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RegisterResponse& from);
-  void MergeFrom(const RegisterResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterResponse& from) {
+    RegisterResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RegisterResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Kuser.RegisterResponse";
   }
   protected:
-  explicit RegisterResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RegisterResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_user_2eproto);
-    return ::descriptor_table_user_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -898,7 +885,7 @@ class RegisterResponse PROTOBUF_FINAL :
   public:
   void clear_result();
   const ::Kuser::ResultCode& result() const;
-  ::Kuser::ResultCode* release_result();
+  PROTOBUF_NODISCARD ::Kuser::ResultCode* release_result();
   ::Kuser::ResultCode* mutable_result();
   void set_allocated_result(::Kuser::ResultCode* result);
   private:
@@ -925,9 +912,12 @@ class RegisterResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::Kuser::ResultCode* result_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::Kuser::ResultCode* result_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_user_2eproto;
 };
 // ===================================================================
@@ -1010,74 +1000,58 @@ class UserServiceRpc_Stub : public UserServiceRpc {
 
 // int32 errcode = 1;
 inline void ResultCode::clear_errcode() {
-  errcode_ = 0;
+  _impl_.errcode_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ResultCode::_internal_errcode() const {
-  return errcode_;
+inline int32_t ResultCode::_internal_errcode() const {
+  return _impl_.errcode_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ResultCode::errcode() const {
+inline int32_t ResultCode::errcode() const {
   // @@protoc_insertion_point(field_get:Kuser.ResultCode.errcode)
   return _internal_errcode();
 }
-inline void ResultCode::_internal_set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void ResultCode::_internal_set_errcode(int32_t value) {
   
-  errcode_ = value;
+  _impl_.errcode_ = value;
 }
-inline void ResultCode::set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void ResultCode::set_errcode(int32_t value) {
   _internal_set_errcode(value);
   // @@protoc_insertion_point(field_set:Kuser.ResultCode.errcode)
 }
 
 // bytes errmsg = 2;
 inline void ResultCode::clear_errmsg() {
-  errmsg_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.errmsg_.ClearToEmpty();
 }
 inline const std::string& ResultCode::errmsg() const {
   // @@protoc_insertion_point(field_get:Kuser.ResultCode.errmsg)
   return _internal_errmsg();
 }
-inline void ResultCode::set_errmsg(const std::string& value) {
-  _internal_set_errmsg(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResultCode::set_errmsg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.errmsg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Kuser.ResultCode.errmsg)
 }
 inline std::string* ResultCode::mutable_errmsg() {
+  std::string* _s = _internal_mutable_errmsg();
   // @@protoc_insertion_point(field_mutable:Kuser.ResultCode.errmsg)
-  return _internal_mutable_errmsg();
+  return _s;
 }
 inline const std::string& ResultCode::_internal_errmsg() const {
-  return errmsg_.Get();
+  return _impl_.errmsg_.Get();
 }
 inline void ResultCode::_internal_set_errmsg(const std::string& value) {
   
-  errmsg_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void ResultCode::set_errmsg(std::string&& value) {
-  
-  errmsg_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Kuser.ResultCode.errmsg)
-}
-inline void ResultCode::set_errmsg(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  errmsg_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Kuser.ResultCode.errmsg)
-}
-inline void ResultCode::set_errmsg(const void* value,
-    size_t size) {
-  
-  errmsg_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Kuser.ResultCode.errmsg)
+  _impl_.errmsg_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ResultCode::_internal_mutable_errmsg() {
   
-  return errmsg_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.errmsg_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ResultCode::release_errmsg() {
   // @@protoc_insertion_point(field_release:Kuser.ResultCode.errmsg)
-  return errmsg_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.errmsg_.Release();
 }
 inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
   if (errmsg != nullptr) {
@@ -1085,28 +1059,13 @@ inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
   } else {
     
   }
-  errmsg_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), errmsg,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Kuser.ResultCode.errmsg)
-}
-inline std::string* ResultCode::unsafe_arena_release_errmsg() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Kuser.ResultCode.errmsg)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return errmsg_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void ResultCode::unsafe_arena_set_allocated_errmsg(
-    std::string* errmsg) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (errmsg != nullptr) {
-    
-  } else {
-    
+  _impl_.errmsg_.SetAllocated(errmsg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.errmsg_.IsDefault()) {
+    _impl_.errmsg_.Set("", GetArenaForAllocation());
   }
-  errmsg_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      errmsg, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Kuser.ResultCode.errmsg)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Kuser.ResultCode.errmsg)
 }
 
 // -------------------------------------------------------------------
@@ -1115,54 +1074,38 @@ inline void ResultCode::unsafe_arena_set_allocated_errmsg(
 
 // bytes name = 1;
 inline void LoginRequest::clear_name() {
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& LoginRequest::name() const {
   // @@protoc_insertion_point(field_get:Kuser.LoginRequest.name)
   return _internal_name();
 }
-inline void LoginRequest::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Kuser.LoginRequest.name)
 }
 inline std::string* LoginRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:Kuser.LoginRequest.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& LoginRequest::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void LoginRequest::_internal_set_name(const std::string& value) {
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void LoginRequest::set_name(std::string&& value) {
-  
-  name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Kuser.LoginRequest.name)
-}
-inline void LoginRequest::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Kuser.LoginRequest.name)
-}
-inline void LoginRequest::set_name(const void* value,
-    size_t size) {
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Kuser.LoginRequest.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* LoginRequest::_internal_mutable_name() {
   
-  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* LoginRequest::release_name() {
   // @@protoc_insertion_point(field_release:Kuser.LoginRequest.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void LoginRequest::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -1170,80 +1113,49 @@ inline void LoginRequest::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Kuser.LoginRequest.name)
-}
-inline std::string* LoginRequest::unsafe_arena_release_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Kuser.LoginRequest.name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void LoginRequest::unsafe_arena_set_allocated_name(
-    std::string* name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (name != nullptr) {
-    
-  } else {
-    
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Kuser.LoginRequest.name)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Kuser.LoginRequest.name)
 }
 
 // bytes pwd = 2;
 inline void LoginRequest::clear_pwd() {
-  pwd_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.pwd_.ClearToEmpty();
 }
 inline const std::string& LoginRequest::pwd() const {
   // @@protoc_insertion_point(field_get:Kuser.LoginRequest.pwd)
   return _internal_pwd();
 }
-inline void LoginRequest::set_pwd(const std::string& value) {
-  _internal_set_pwd(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_pwd(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwd_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Kuser.LoginRequest.pwd)
 }
 inline std::string* LoginRequest::mutable_pwd() {
+  std::string* _s = _internal_mutable_pwd();
   // @@protoc_insertion_point(field_mutable:Kuser.LoginRequest.pwd)
-  return _internal_mutable_pwd();
+  return _s;
 }
 inline const std::string& LoginRequest::_internal_pwd() const {
-  return pwd_.Get();
+  return _impl_.pwd_.Get();
 }
 inline void LoginRequest::_internal_set_pwd(const std::string& value) {
   
-  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void LoginRequest::set_pwd(std::string&& value) {
-  
-  pwd_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Kuser.LoginRequest.pwd)
-}
-inline void LoginRequest::set_pwd(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Kuser.LoginRequest.pwd)
-}
-inline void LoginRequest::set_pwd(const void* value,
-    size_t size) {
-  
-  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Kuser.LoginRequest.pwd)
+  _impl_.pwd_.Set(value, GetArenaForAllocation());
 }
 inline std::string* LoginRequest::_internal_mutable_pwd() {
   
-  return pwd_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.pwd_.Mutable(GetArenaForAllocation());
 }
 inline std::string* LoginRequest::release_pwd() {
   // @@protoc_insertion_point(field_release:Kuser.LoginRequest.pwd)
-  return pwd_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.pwd_.Release();
 }
 inline void LoginRequest::set_allocated_pwd(std::string* pwd) {
   if (pwd != nullptr) {
@@ -1251,28 +1163,13 @@ inline void LoginRequest::set_allocated_pwd(std::string* pwd) {
   } else {
     
   }
-  pwd_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), pwd,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Kuser.LoginRequest.pwd)
-}
-inline std::string* LoginRequest::unsafe_arena_release_pwd() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Kuser.LoginRequest.pwd)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return pwd_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void LoginRequest::unsafe_arena_set_allocated_pwd(
-    std::string* pwd) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (pwd != nullptr) {
-    
-  } else {
-    
+  _impl_.pwd_.SetAllocated(pwd, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwd_.IsDefault()) {
+    _impl_.pwd_.Set("", GetArenaForAllocation());
   }
-  pwd_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      pwd, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Kuser.LoginRequest.pwd)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Kuser.LoginRequest.pwd)
 }
 
 // -------------------------------------------------------------------
@@ -1281,21 +1178,21 @@ inline void LoginRequest::unsafe_arena_set_allocated_pwd(
 
 // .Kuser.ResultCode result = 1;
 inline bool LoginResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
 }
 inline bool LoginResponse::has_result() const {
   return _internal_has_result();
 }
 inline void LoginResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  result_ = nullptr;
+  _impl_.result_ = nullptr;
 }
 inline const ::Kuser::ResultCode& LoginResponse::_internal_result() const {
-  const ::Kuser::ResultCode* p = result_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Kuser::ResultCode*>(
-      &::Kuser::_ResultCode_default_instance_);
+  const ::Kuser::ResultCode* p = _impl_.result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Kuser::ResultCode&>(
+      ::Kuser::_ResultCode_default_instance_);
 }
 inline const ::Kuser::ResultCode& LoginResponse::result() const {
   // @@protoc_insertion_point(field_get:Kuser.LoginResponse.result)
@@ -1303,10 +1200,10 @@ inline const ::Kuser::ResultCode& LoginResponse::result() const {
 }
 inline void LoginResponse::unsafe_arena_set_allocated_result(
     ::Kuser::ResultCode* result) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
   }
-  result_ = result;
+  _impl_.result_ = result;
   if (result) {
     
   } else {
@@ -1315,39 +1212,48 @@ inline void LoginResponse::unsafe_arena_set_allocated_result(
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Kuser.LoginResponse.result)
 }
 inline ::Kuser::ResultCode* LoginResponse::release_result() {
-  auto temp = unsafe_arena_release_result();
-  if (GetArena() != nullptr) {
+  
+  ::Kuser::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::Kuser::ResultCode* LoginResponse::unsafe_arena_release_result() {
   // @@protoc_insertion_point(field_release:Kuser.LoginResponse.result)
   
-  ::Kuser::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::Kuser::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
   return temp;
 }
 inline ::Kuser::ResultCode* LoginResponse::_internal_mutable_result() {
   
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Kuser::ResultCode>(GetArena());
-    result_ = p;
+  if (_impl_.result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Kuser::ResultCode>(GetArenaForAllocation());
+    _impl_.result_ = p;
   }
-  return result_;
+  return _impl_.result_;
 }
 inline ::Kuser::ResultCode* LoginResponse::mutable_result() {
+  ::Kuser::ResultCode* _msg = _internal_mutable_result();
   // @@protoc_insertion_point(field_mutable:Kuser.LoginResponse.result)
-  return _internal_mutable_result();
+  return _msg;
 }
 inline void LoginResponse::set_allocated_result(::Kuser::ResultCode* result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete result_;
+    delete _impl_.result_;
   }
   if (result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
     if (message_arena != submessage_arena) {
       result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, result, submessage_arena);
@@ -1356,16 +1262,16 @@ inline void LoginResponse::set_allocated_result(::Kuser::ResultCode* result) {
   } else {
     
   }
-  result_ = result;
+  _impl_.result_ = result;
   // @@protoc_insertion_point(field_set_allocated:Kuser.LoginResponse.result)
 }
 
 // bool success = 2;
 inline void LoginResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool LoginResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool LoginResponse::success() const {
   // @@protoc_insertion_point(field_get:Kuser.LoginResponse.success)
@@ -1373,7 +1279,7 @@ inline bool LoginResponse::success() const {
 }
 inline void LoginResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void LoginResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -1386,74 +1292,58 @@ inline void LoginResponse::set_success(bool value) {
 
 // uint32 id = 1;
 inline void RegisterRequest::clear_id() {
-  id_ = 0u;
+  _impl_.id_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 RegisterRequest::_internal_id() const {
-  return id_;
+inline uint32_t RegisterRequest::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 RegisterRequest::id() const {
+inline uint32_t RegisterRequest::id() const {
   // @@protoc_insertion_point(field_get:Kuser.RegisterRequest.id)
   return _internal_id();
 }
-inline void RegisterRequest::_internal_set_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void RegisterRequest::_internal_set_id(uint32_t value) {
   
-  id_ = value;
+  _impl_.id_ = value;
 }
-inline void RegisterRequest::set_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void RegisterRequest::set_id(uint32_t value) {
   _internal_set_id(value);
   // @@protoc_insertion_point(field_set:Kuser.RegisterRequest.id)
 }
 
 // bytes name = 2;
 inline void RegisterRequest::clear_name() {
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& RegisterRequest::name() const {
   // @@protoc_insertion_point(field_get:Kuser.RegisterRequest.name)
   return _internal_name();
 }
-inline void RegisterRequest::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Kuser.RegisterRequest.name)
 }
 inline std::string* RegisterRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:Kuser.RegisterRequest.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& RegisterRequest::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void RegisterRequest::_internal_set_name(const std::string& value) {
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void RegisterRequest::set_name(std::string&& value) {
-  
-  name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Kuser.RegisterRequest.name)
-}
-inline void RegisterRequest::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Kuser.RegisterRequest.name)
-}
-inline void RegisterRequest::set_name(const void* value,
-    size_t size) {
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Kuser.RegisterRequest.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RegisterRequest::_internal_mutable_name() {
   
-  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RegisterRequest::release_name() {
   // @@protoc_insertion_point(field_release:Kuser.RegisterRequest.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void RegisterRequest::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -1461,80 +1351,49 @@ inline void RegisterRequest::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Kuser.RegisterRequest.name)
-}
-inline std::string* RegisterRequest::unsafe_arena_release_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Kuser.RegisterRequest.name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void RegisterRequest::unsafe_arena_set_allocated_name(
-    std::string* name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (name != nullptr) {
-    
-  } else {
-    
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Kuser.RegisterRequest.name)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Kuser.RegisterRequest.name)
 }
 
 // bytes pwd = 3;
 inline void RegisterRequest::clear_pwd() {
-  pwd_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.pwd_.ClearToEmpty();
 }
 inline const std::string& RegisterRequest::pwd() const {
   // @@protoc_insertion_point(field_get:Kuser.RegisterRequest.pwd)
   return _internal_pwd();
 }
-inline void RegisterRequest::set_pwd(const std::string& value) {
-  _internal_set_pwd(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterRequest::set_pwd(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwd_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Kuser.RegisterRequest.pwd)
 }
 inline std::string* RegisterRequest::mutable_pwd() {
+  std::string* _s = _internal_mutable_pwd();
   // @@protoc_insertion_point(field_mutable:Kuser.RegisterRequest.pwd)
-  return _internal_mutable_pwd();
+  return _s;
 }
 inline const std::string& RegisterRequest::_internal_pwd() const {
-  return pwd_.Get();
+  return _impl_.pwd_.Get();
 }
 inline void RegisterRequest::_internal_set_pwd(const std::string& value) {
   
-  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void RegisterRequest::set_pwd(std::string&& value) {
-  
-  pwd_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Kuser.RegisterRequest.pwd)
-}
-inline void RegisterRequest::set_pwd(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Kuser.RegisterRequest.pwd)
-}
-inline void RegisterRequest::set_pwd(const void* value,
-    size_t size) {
-  
-  pwd_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Kuser.RegisterRequest.pwd)
+  _impl_.pwd_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RegisterRequest::_internal_mutable_pwd() {
   
-  return pwd_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.pwd_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RegisterRequest::release_pwd() {
   // @@protoc_insertion_point(field_release:Kuser.RegisterRequest.pwd)
-  return pwd_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.pwd_.Release();
 }
 inline void RegisterRequest::set_allocated_pwd(std::string* pwd) {
   if (pwd != nullptr) {
@@ -1542,28 +1401,13 @@ inline void RegisterRequest::set_allocated_pwd(std::string* pwd) {
   } else {
     
   }
-  pwd_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), pwd,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Kuser.RegisterRequest.pwd)
-}
-inline std::string* RegisterRequest::unsafe_arena_release_pwd() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Kuser.RegisterRequest.pwd)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return pwd_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void RegisterRequest::unsafe_arena_set_allocated_pwd(
-    std::string* pwd) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (pwd != nullptr) {
-    
-  } else {
-    
+  _impl_.pwd_.SetAllocated(pwd, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwd_.IsDefault()) {
+    _impl_.pwd_.Set("", GetArenaForAllocation());
   }
-  pwd_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      pwd, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Kuser.RegisterRequest.pwd)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Kuser.RegisterRequest.pwd)
 }
 
 // -------------------------------------------------------------------
@@ -1572,21 +1416,21 @@ inline void RegisterRequest::unsafe_arena_set_allocated_pwd(
 
 // .Kuser.ResultCode result = 1;
 inline bool RegisterResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
 }
 inline bool RegisterResponse::has_result() const {
   return _internal_has_result();
 }
 inline void RegisterResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  result_ = nullptr;
+  _impl_.result_ = nullptr;
 }
 inline const ::Kuser::ResultCode& RegisterResponse::_internal_result() const {
-  const ::Kuser::ResultCode* p = result_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Kuser::ResultCode*>(
-      &::Kuser::_ResultCode_default_instance_);
+  const ::Kuser::ResultCode* p = _impl_.result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Kuser::ResultCode&>(
+      ::Kuser::_ResultCode_default_instance_);
 }
 inline const ::Kuser::ResultCode& RegisterResponse::result() const {
   // @@protoc_insertion_point(field_get:Kuser.RegisterResponse.result)
@@ -1594,10 +1438,10 @@ inline const ::Kuser::ResultCode& RegisterResponse::result() const {
 }
 inline void RegisterResponse::unsafe_arena_set_allocated_result(
     ::Kuser::ResultCode* result) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
   }
-  result_ = result;
+  _impl_.result_ = result;
   if (result) {
     
   } else {
@@ -1606,39 +1450,48 @@ inline void RegisterResponse::unsafe_arena_set_allocated_result(
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Kuser.RegisterResponse.result)
 }
 inline ::Kuser::ResultCode* RegisterResponse::release_result() {
-  auto temp = unsafe_arena_release_result();
-  if (GetArena() != nullptr) {
+  
+  ::Kuser::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::Kuser::ResultCode* RegisterResponse::unsafe_arena_release_result() {
   // @@protoc_insertion_point(field_release:Kuser.RegisterResponse.result)
   
-  ::Kuser::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::Kuser::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
   return temp;
 }
 inline ::Kuser::ResultCode* RegisterResponse::_internal_mutable_result() {
   
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Kuser::ResultCode>(GetArena());
-    result_ = p;
+  if (_impl_.result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Kuser::ResultCode>(GetArenaForAllocation());
+    _impl_.result_ = p;
   }
-  return result_;
+  return _impl_.result_;
 }
 inline ::Kuser::ResultCode* RegisterResponse::mutable_result() {
+  ::Kuser::ResultCode* _msg = _internal_mutable_result();
   // @@protoc_insertion_point(field_mutable:Kuser.RegisterResponse.result)
-  return _internal_mutable_result();
+  return _msg;
 }
 inline void RegisterResponse::set_allocated_result(::Kuser::ResultCode* result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete result_;
+    delete _impl_.result_;
   }
   if (result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
     if (message_arena != submessage_arena) {
       result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, result, submessage_arena);
@@ -1647,16 +1500,16 @@ inline void RegisterResponse::set_allocated_result(::Kuser::ResultCode* result)
   } else {
     
   }
-  result_ = result;
+  _impl_.result_ = result;
   // @@protoc_insertion_point(field_set_allocated:Kuser.RegisterResponse.result)
 }
 
 // bool success = 2;
 inline void RegisterResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool RegisterResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool RegisterResponse::success() const {
   // @@protoc_insertion_point(field_get:Kuser.RegisterResponse.success)
@@ -1664,7 +1517,7 @@ inline bool RegisterResponse::success() const {
 }
 inline void RegisterResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void RegisterResponse::set_success(bool value) {
   _internal_set_success(value);
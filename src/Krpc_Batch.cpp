@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_Batch.cpp
+  * @author         : 18483
+  * @brief          : 客户端批量调用实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_Batch.h"
+#include "Krpc_Controller.h"
+#include "Krpc_MethodId.h"
+#include "Krpcheader.pb.h"
+
+/**
+ * @brief 同一服务的一个批量请求
+ * @details 自身作为批量请求的 done，批量响应到达（或整个批量请求失败）后把结果分发给每个调用，然后释放自己
+ */
+class KrpcBatch::Group : public google::protobuf::Closure {
+public:
+    explicit Group(const std::string &service_name) : service_name(service_name) {}
+
+    void Run() override {
+        // 整个批量请求失败时，例如超时 或 连接出错，所有调用都以同样的原因失败
+        KrpcBatch::Complete(entries, controller.Failed() ? controller.ErrorCode() : Krpc::RPC_OK,
+                            controller.ErrorText(), &response);
+        delete this;
+    }
+
+    std::string service_name;
+    std::vector<Entry> entries;
+    /// 整个批量请求的控制器、请求和响应
+    KrpcController controller;
+    Krpc::RpcBatchRequest request;
+    Krpc::RpcBatchResponse response;
+};
+
+/**
+ * @brief 构造函数
+ */
+KrpcBatch::KrpcBatch(KrpcChannel *channel) : m_channel(channel), m_size(0) {
+}
+
+/**
+ * @brief 析构函数 发送所有未发送的调用，保证每个调用的 done 都会被执行
+ */
+KrpcBatch::~KrpcBatch() {
+    Send();
+}
+
+/**
+ * @brief 发起调用
+ * @details 请求参数在这里序列化，调用方不需要保证 request 在 Send 之前一直有效
+ */
+void KrpcBatch::CallMethod(const ::google::protobuf::MethodDescriptor *method,
+                           ::google::protobuf::RpcController *controller,
+                           const ::google::protobuf::Message *request,
+                           ::google::protobuf::Message *response,
+                           ::google::protobuf::Closure *done) {
+    if(done == nullptr) {
+        m_channel->CallMethod(method, controller, request, response, nullptr);
+        return;
+    }
+    if(!request->IsInitialized()) {
+        KrpcController::FailCall(controller, done, Krpc::RPC_BAD_REQUEST, "serialize request fail!");
+        return;
+    }
+    /// 找到该服务的批量请求，服务数通常很少，顺序查找即可
+    const std::string &service_name = method->service()->name();
+    Group *group = nullptr;
+    for(Group *g : m_groups) {
+        if(g->service_name == service_name) {
+            group = g;
+            break;
+        }
+    }
+    if(group == nullptr) {
+        group = new Group(service_name);
+        m_groups.push_back(group);
+    }
+    /// 批量请求的超时时间取其中最短的一个
+    KrpcController *krpc_controller = dynamic_cast<KrpcController*>(controller);
+    if(krpc_controller != nullptr && krpc_controller->GetTimeout() > 0
+       && (group->controller.GetTimeout() == 0 || krpc_controller->GetTimeout() < group->controller.GetTimeout())) {
+        group->controller.SetTimeout(krpc_controller->GetTimeout());
+    }
+    Krpc::RpcBatchEntry *batch_entry = group->request.add_entries();
+    batch_entry->set_method_id(KrpcMethodId::Of(method));
+    request->SerializeToString(batch_entry->mutable_args());
+    Entry entry;
+    entry.controller = controller;
+    entry.response = response;
+    entry.done = done;
+    group->entries.push_back(entry);
+    ++m_size;
+}
+
+/**
+ * @brief 发送所有暂存的调用
+ * @details 先取出暂存的调用再发送，批量请求立即失败时 done 会在当前线程中执行，其中可以再次使用 batch
+ */
+void KrpcBatch::Send() {
+    std::vector<Group*> groups;
+    groups.swap(m_groups);
+    m_size = 0;
+    for(Group *group : groups) {
+        Krpc::RpcHeader header;
+        header.set_batch(true);
+        m_channel->SendCall(group->service_name, &header, &group->controller,
+                            &group->request, &group->response, group, nullptr);
+    }
+}
+
+/**
+ * @brief 批量请求结束，把结果分发给其中的每个调用
+ */
+void KrpcBatch::Complete(const std::vector<Entry> &entries, int status, const std::string &err,
+                         const Krpc::RpcBatchResponse *response) {
+    for(size_t i = 0; i < entries.size(); ++i) {
+        const Krpc::RpcBatchResult *result = nullptr;
+        if(status == Krpc::RPC_OK && static_cast<int>(i) < response->results_size()) {
+            result = &response->results(static_cast<int>(i));
+        }
+        CompleteEntry(entries[i], status, err, result);
+    }
+}
+
+/**
+ * @brief 结束批量请求中的一个调用
+ */
+void KrpcBatch::CompleteEntry(const Entry &entry, int status, const std::string &err,
+                              const Krpc::RpcBatchResult *result) {
+    if(status != Krpc::RPC_OK) {
+        KrpcController::FailCall(entry.controller, entry.done, status, err);
+    } else if(result == nullptr) {
+        KrpcController::FailCall(entry.controller, entry.done, Krpc::RPC_BAD_RESPONSE, "batch response mismatch!");
+    } else if(result->status() != Krpc::RPC_OK) {
+        KrpcController::FailCall(entry.controller, entry.done, result->status(), result->error_text());
+    } else if(!entry.response->ParseFromString(result->body())) {
+        KrpcController::FailCall(entry.controller, entry.done, Krpc::RPC_BAD_RESPONSE, "parse response error!");
+    } else {
+        entry.done->Run();
+    }
+}
@@ -13,6 +13,14 @@
 #include "zookeeperUtil.h"
 #include "Krpc_Application.h"
 #include "Krpc_Controller.h"
+#include "Krpc_ConnectionPool.h"
+#include "Krpc_MethodId.h"
+#include "Krpc_Pipeline.h"
+#include "Krpc_MicroBatcher.h"
+#include "Krpc_ServiceDiscovery.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
 #include <memory>
 #include <error.h>
 #include <unistd.h>
@@ -21,191 +29,246 @@
 #include <arpa/inet.h>
 #include "Krpc_Logger.h"
 
-/// 全局互斥锁 用于保护共享数据的线程安全
-std::mutex g_data_mutex;
-
 /**
- * @brief 构造函数 支持延迟连接
+ * @brief 同步调用的完成回调，调用方在 Wait 中等待异步调用结束
  */
-KrpcChannel::KrpcChannel(bool connectNow)
-        :m_clientfd(-1), m_idx(0) {
-    if(!connectNow) { // 不需要立即连接
-        return;
+struct SyncDone : public google::protobuf::Closure {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool finished = false;
+    void Run() override {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+        cv.notify_one();
     }
-    // 尝试连接服务器 最多重试 3 次
-    auto rt = newConnect(m_ip.c_str(), m_port);
-    int count = 3;
-    while(!rt && count--) {
-        rt = newConnect(m_ip.c_str(), m_port);
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return finished; });
     }
+};
+
+/**
+ * @brief 构造函数 支持延迟连接
+ * @details 服务地址由全局的服务发现缓存查询，连接由全局连接池统一管理，
+ *          Channel 本身不再持有连接，只需要确定负载均衡策略
+ */
+KrpcChannel::KrpcChannel(bool connectNow) : m_balancer(KrpcLoadBalancer::Default()) {
+    // 未在 controller 中设置超时时间的调用使用配置的默认超时时间，未配置时不限时
+    int timeout_ms = atoi(KrpcApplication::GetInstance().GetConfig().Load("rpc_timeout_ms").c_str());
+    m_defaultTimeoutMs = timeout_ms > 0 ? timeout_ms : 0;
+    // 自动攒批，未配置 batch_linger_us 时关闭
+    int linger_us = atoi(KrpcApplication::GetInstance().GetConfig().Load("batch_linger_us").c_str());
+    int max_batch = atoi(KrpcApplication::GetInstance().GetConfig().Load("batch_max_size").c_str());
+    EnableBatching(linger_us, max_batch > 0 ? max_batch : 64);
+}
+
+/**
+ * @brief 开启或关闭自动攒批模式
+ */
+void KrpcChannel::EnableBatching(int linger_us, size_t max_batch) {
+    m_batchLingerUs = linger_us > 0 ? linger_us : 0;
+    m_batchMaxSize = max_batch > 0 ? max_batch : 1;
 }
 
 
 /**
  * @brief  RPC 调用的核心方法
- * @details 负责将客户端的请求序列化并发送到服务器，同时接收服务端的响应
+ * @details 负责将客户端的请求序列化并发送到服务器，同时接收服务端的响应。
+ *          done 为空时阻塞等待响应；done 不为空时发送请求后立即返回，
+ *          调用结束（成功或失败）后在客户端事件循环线程中设置好 controller 和 response 并执行 done->Run()，
+ *          因此 done 中不能再发起同步调用，也不应执行耗时的操作。
+ *          超时时间取 KrpcController::SetTimeout 设置的值，未设置时使用配置项 rpc_timeout_ms。
+ *          调用进行期间可以通过 KrpcController::StartCancel 取消，被取消的异步调用在调用 StartCancel 的线程中执行 done
  */
 void KrpcChannel::CallMethod(const ::google::protobuf::MethodDescriptor *method,
                              ::google::protobuf::RpcController *controller,
                              const ::google::protobuf::Message *request,
                              ::google::protobuf::Message *response,
                              ::google::protobuf::Closure *done) {
-    // 如果客户端socket未初始化
-    if(-1 == m_clientfd){
-        /// 获取服务对象名和方法名
-        const google::protobuf::ServiceDescriptor *sd = method->service();
-        service_name = sd->name();    // 服务名
-        method_name = method->name(); // 方法名
-
-        /// 客户端查询 ZooKeeper 找到提供该服务的服务器地址
-        ZkClient zkCli;
-        zkCli.Start();   // 连接zookeeper 服务器
-        // 查询服务地址
-        std::string host_data = QueryServiceHost(&zkCli, service_name, method_name, m_idx);
-        m_ip = host_data.substr(0, m_idx);  // 提取IP地址
-        std::cout << "ip: " << m_ip << std::endl;
-        m_port = atoi(host_data.substr(m_idx + 1, host_data.size() - m_idx).c_str()); // 端口号
-        std::cout << "port: " << m_port << std::endl;
-
-        /// 尝试连接服务器
-        auto rt = newConnect(m_ip.c_str(), m_port);
-        if(!rt) {
-            LOG(ERROR) << "connect server error";
-            return;
+    if(done != nullptr) {
+        if(m_batchLingerUs > 0) {
+            AddToBatch(method, controller, request, response, done);
         } else {
-            LOG(INFO) << "connect server success";
+            StartCall(method, controller, request, response, done, nullptr);
         }
-    }
-
-    /// 将请求参数序列化为字符串，并计算其长度
-    uint32_t args_size{};
-    std::string args_str;
-    if(request->SerializeToString(&args_str)) {  // 序列化请求参数
-        args_size = args_str.size();  // 获取序列化后的长度
-    } else {
-        controller->SetFailed("serialize request fail!");
         return;
     }
-
-    /// 定义 RPC 请求的头部信息
-    Krpc::RpcHeader krpcheader;
-    krpcheader.set_service_name(service_name);
-    krpcheader.set_method_name(method_name);
-    krpcheader.set_args_size(args_size);
-
-    /// 将 RPC 头部信息序列化为字符串，并计算其长度
-    uint32_t header_size = 0;
-    std::string rpc_header_str;
-    if(krpcheader.SerializeToString(&rpc_header_str)) { // 序列化头部信息
-        header_size = rpc_header_str.size();   // 获取头部序列化后的长度
+    /// 同步调用按异步调用发起，在这里等待调用结束；开启攒批时同样加入攒批窗口
+    SyncDone sync_done;
+    if(m_batchLingerUs > 0) {
+        AddToBatch(method, controller, request, response, &sync_done);
     } else {
-        controller->SetFailed("serialize rpc header error!");
-        return;
+        StartCall(method, controller, request, response, &sync_done, nullptr);
     }
+    sync_done.Wait();
+}
 
-    /*
-     * RPC_Str --> { header:[header_size, (service_name, method_name, args_size)], args_str}
-     */
-
-    /// 将头部长度和头部信息拼接成完整的 RPC 请求报文
-    std::string send_rpc_str;
-    {
-        google::protobuf::io::StringOutputStream string_output(&send_rpc_str);
-        google::protobuf::io::CodedOutputStream coded_output(&string_output);
-        coded_output.WriteVarint32(static_cast<uint32_t>(header_size)); // 写入头部信息
-        coded_output.WriteString(rpc_header_str);  // 写入头部信息
-    }
-    send_rpc_str += args_str;   // 拼接请求参数
-
-    /// 发送 RPC 请求到服务器
-    if(-1 == send(m_clientfd, send_rpc_str.c_str(), send_rpc_str.size(), 0)) {
-        close(m_clientfd); // 发送失败 关闭socket
-        char errtxt[512] = {};
-        std::cout << "SEND error: " << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl;
-        controller->SetFailed(errtxt);
+/**
+ * @brief 选好服务端实例后把异步调用交给 KrpcMicroBatcher
+ * @details 服务发现和选择实例在调用线程中完成，攒批器的定时器中只负责发送
+ */
+void KrpcChannel::AddToBatch(const ::google::protobuf::MethodDescriptor *method,
+                             ::google::protobuf::RpcController *controller,
+                             const ::google::protobuf::Message *request,
+                             ::google::protobuf::Message *response,
+                             ::google::protobuf::Closure *done) {
+    KrpcController *krpc_controller = dynamic_cast<KrpcController*>(controller);
+    int timeout_ms = CallTimeout(krpc_controller);
+    KrpcInstanceList instances = KrpcServiceDiscovery::GetInstance().GetInstances(method->service()->name());
+    if(!instances) {
+        KrpcController::FailCall(controller, done, Krpc::RPC_SERVICE_UNAVAILABLE, "query service host error!");
         return;
     }
-
-    /// 接收服务器的响应
-    char recv_buf[1024] = {0};
-    int recv_size = 0;
-    if(-1 == (recv_size = recv(m_clientfd, recv_buf, 1024, 0))) {
-        char errtxt[512] = {};
-        std::cout << "RECV error: " << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl;
-        controller->SetFailed(errtxt);
+    const KrpcServiceInstance &instance = m_balancer->Select(*instances);
+    if(!request->IsInitialized()) {
+        KrpcController::FailCall(controller, done, Krpc::RPC_BAD_REQUEST, "serialize request fail!");
         return;
     }
-
-    /// 反序列化接收到的响应数据 为 response 对象
-    if(!response->ParseFromArray(recv_buf, recv_size)) {
-        close(m_clientfd); // 反序列化失败 关闭socket
-        char errtxt[512] = {};
-        std::cout << "PARSE error: " << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl;
-        controller->SetFailed(errtxt);
+    if(krpc_controller != nullptr && krpc_controller->IsCanceled()) {
+        KrpcController::FailCall(controller, done, Krpc::RPC_CANCELED, "rpc canceled");
         return;
     }
-    // 关闭连接
-    close(m_clientfd);
+    KrpcMicroBatcher::GetInstance().Add(instance.ip, instance.port, method, controller, request, response, done,
+                                        timeout_ms, m_batchLingerUs, m_batchMaxSize);
 }
 
 /**
- * @brief 创建新的 socket 连接
+ * @brief 本次调用的超时时间
  */
-bool KrpcChannel::newConnect(const char *ip, uint16_t port) {
-    /// 创建socket
-    int clientfd = socket(AF_INET, SOCK_STREAM, 0);
-    if(-1 == clientfd) {
-        char errtxt[512] = {};
-        std::cout << "SOCKET error: " << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl;
-        LOG(ERROR) << "socket error: " << errtxt; // 记录错误日志
-        return false;
-    }
-
-    /// 设置服务器地址信息
-    struct sockaddr_in service_addr;
-    service_addr.sin_family = AF_INET;   // IPv4地址族
-    service_addr.sin_port = htons(port);
-    service_addr.sin_addr.s_addr = inet_addr(ip);
-
-    /// 尝试连接服务器
-    if(-1 == connect(clientfd, (struct sockaddr*)&service_addr, sizeof(service_addr))) {
-        close(clientfd);
-        char errtxt[512] = {};
-        std::cout << "CONNECT error: " << strerror_r(errno, errtxt, sizeof(errtxt)) << std::endl;
-        LOG(ERROR) << "connect error: " << errtxt; // 记录错误日志
-        return false;
-    }
+int KrpcChannel::CallTimeout(const KrpcController *controller) const {
+    return (controller != nullptr && controller->GetTimeout() > 0) ? controller->GetTimeout() : m_defaultTimeoutMs;
+}
 
-    /// 保存 socket 文件描述符
-    m_clientfd = clientfd;
-    return true;
+/**
+ * @brief 发起一次调用
+ */
+void KrpcChannel::StartCall(const ::google::protobuf::MethodDescriptor *method,
+                            ::google::protobuf::RpcController *controller,
+                            const ::google::protobuf::Message *request,
+                            ::google::protobuf::Message *response,
+                            ::google::protobuf::Closure *done,
+                            KrpcPipeline *pipeline) {
+    /// 定义 RPC 请求的头部信息
+    Krpc::RpcHeader krpcheader;
+    // 只携带方法 id，不再携带服务名和方法名，缩短请求头，服务端也不需要按字符串查找方法
+    krpcheader.set_method_id(KrpcMethodId::Of(method));
+    SendCall(method->service()->name(), &krpcheader, controller, request, response, done, pipeline);
 }
 
 /**
- * @brief 从 ZooKeeper 查询服务地址
+ * @brief 发送一次请求头已经确定的调用
+ * @details 服务发现、选择实例、获取连接和编码请求都在调用线程中完成，
+ *          最后一步把请求帧交给连接发送，或者交给 pipeline 暂存
  */
-std::string KrpcChannel::QueryServiceHost(ZkClient *zkclient, std::string service_name,
-                                          std::string method_name, int &idx) {
-    // 构造 ZooKeeper 路径
-    std::string method_path = "/" + service_name + "/" + method_name;
-    std::cout << "method_path: " << method_path << std::endl;
-
-    std::unique_lock<std::mutex> lock(g_data_mutex);  // 加锁
-    std::string host_data_1 = zkclient->GetData(method_path.c_str());  // 获取数据
-    lock.unlock();  // 解锁
-
-    if(host_data_1 == "") {
-        LOG(ERROR) << method_path + " is not exist!";
-        return " ";
+void KrpcChannel::SendCall(const std::string &service_name, Krpc::RpcHeader *header,
+                           ::google::protobuf::RpcController *controller,
+                           const ::google::protobuf::Message *request,
+                           ::google::protobuf::Message *response,
+                           ::google::protobuf::Closure *done,
+                           KrpcPipeline *pipeline) {
+    /// 确定本次调用的截止时间，建立连接、发送请求和等待响应都计算在内。
+    /// 服务发现缓存未命中时访问 ZooKeeper 的查询不受截止时间约束，查询耗尽预算的调用在发送前以超时失败
+    KrpcController *krpc_controller = dynamic_cast<KrpcController*>(controller);
+    int timeout_ms = CallTimeout(krpc_controller);
+    std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    /// 查询提供该服务的实例列表，只有第一次查询需要访问 ZooKeeper，之后都命中本地缓存
+    KrpcInstanceList instances = KrpcServiceDiscovery::GetInstance().GetInstances(service_name);
+    if(!instances) {
+        KrpcController::FailCall(controller, done, Krpc::RPC_SERVICE_UNAVAILABLE, "query service host error!");
+        return;
     }
+    /// 按负载均衡策略选出本次调用的实例
+    const KrpcServiceInstance &instance = m_balancer->Select(*instances);
+    const std::string &ip = instance.ip;
+    uint16_t port = instance.port;
 
-    idx = host_data_1.find(":"); // IP 和 端口分隔符
-    if(idx == -1) {
-        LOG(ERROR) << method_path + " address is invalid!";
-        return " ";
+    if(!request->IsInitialized()) {
+        KrpcController::FailCall(controller, done, Krpc::RPC_BAD_REQUEST, "serialize request fail!");
+        return;
     }
-    return host_data_1;  // 返回服务地址
-}
 
+    /// 从连接池获取到服务器的连接，连接可以被多个线程的调用同时使用
+    std::shared_ptr<KrpcClientConnection> conn = KrpcConnectionPool::GetInstance().Acquire(ip, port);
+    if(!conn) {
+        LOG(ERROR) << "connect server error";
+        KrpcController::FailCall(controller, done, Krpc::RPC_NETWORK_ERROR, "connect server error!");
+        return;
+    }
 
+    // 请求 id 用于在同一连接上匹配响应
+    uint64_t request_id = conn->NextRequestId();
+    header->set_request_id(request_id);
+    // 把剩余的超时时间带给服务端，服务端据此丢弃客户端已经放弃等待的请求
+    int remaining_ms = 0;
+    if(timeout_ms > 0) {
+        remaining_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()).count());
+        if(remaining_ms <= 0) {
+            KrpcConnectionPool::GetInstance().Release(conn);
+            KrpcController::FailCall(controller, done, Krpc::RPC_TIMEOUT, "rpc timeout");
+            return;
+        }
+        header->set_timeout_ms(remaining_ms);
+    }
 
+    /// 调用进行期间 StartCancel 取消该连接上的这次调用，调用结束后清除
+    if(krpc_controller != nullptr) {
+        if(krpc_controller->IsCanceled()) {
+            KrpcConnectionPool::GetInstance().Release(conn);
+            KrpcController::FailCall(controller, done, Krpc::RPC_CANCELED, "rpc canceled");
+            return;
+        }
+        std::weak_ptr<KrpcClientConnection> weak_conn(conn);
+        krpc_controller->SetCancelHook([weak_conn, request_id]() {
+            std::shared_ptr<KrpcClientConnection> c = weak_conn.lock();
+            if(c) {
+                c->Cancel(request_id);
+            }
+        });
+    }
+
+    /// 发送后立即返回，响应到达后在事件循环线程中完成调用
+    KrpcClientConnection::ResponseCallback cb =
+            [conn, controller, krpc_controller, response, done](int status, std::string *body,
+                                                                const std::string &err) {
+        KrpcConnectionPool::GetInstance().Release(conn);
+        if(krpc_controller != nullptr) {
+            krpc_controller->SetCancelHook(nullptr);
+            // 取消与响应到达同时发生时，以取消为准
+            if(status == Krpc::RPC_OK && krpc_controller->IsCanceled()) {
+                KrpcController::FailCall(controller, done, Krpc::RPC_CANCELED, "rpc canceled");
+                return;
+            }
+        }
+        if(status != Krpc::RPC_OK) {
+            LOG(ERROR) << "CALL error: " << err;
+            KrpcController::FailCall(controller, done, status, err);
+            return;
+        }
+        if(!response->ParseFromString(*body)) {
+            LOG(ERROR) << "PARSE error: " << conn->Key();
+            KrpcController::FailCall(controller, done, Krpc::RPC_BAD_RESPONSE, "parse response error!");
+            return;
+        }
+        done->Run();
+    };
+    if(pipeline != nullptr) {
+        // 由 pipeline 与其他请求一起发送，请求头在发送时按那时剩余的超时时间编码
+        std::string args;
+        request->SerializeToString(&args);
+        pipeline->Enqueue(conn, *header, &args, timeout_ms > 0, deadline, cb, krpc_controller);
+        return;
+    }
+
+    /// 将头部和请求参数编码成一个完整的请求帧
+    std::string send_rpc_str;
+    KrpcClientConnection::EncodeRequest(header, request, &send_rpc_str);
+    conn->CallAsync(request_id, send_rpc_str, remaining_ms, cb);
+    // 取消可能发生在上面的检查之后、调用在连接上登记之前，此时 cancel hook 找不到这次调用，这里补上；
+    // 调用已经结束时 Cancel 什么也不做
+    if(krpc_controller != nullptr && krpc_controller->IsCanceled()) {
+        conn->Cancel(request_id);
+    }
+}
@@ -0,0 +1,455 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ClientConnection.cpp
+  * @author         : 18483
+  * @brief          : 可多路复用的客户端连接实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_ClientConnection.h"
+#include "Krpcheader.pb.h"
+#include "Krpc_Logger.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <algorithm>
+
+/// 单个响应消息体的最大长度，防止错误的长度字段导致无限制地分配内存
+static const uint32_t kMaxBodySize = 64 * 1024 * 1024;
+/// 响应头的最大长度，服务端会截断过长的错误信息，正常的响应头不会超过这个长度
+static const uint32_t kMaxHeaderSize = 8 * 1024;
+
+/**
+ * @brief 将请求编码为一个完整的请求帧
+ * @details 请求帧格式 { header_size(varint32), RpcHeader:(args_size, request_id, timeout_ms, method_id), args }
+ *          先计算出头部和参数的长度，按整帧长度申请一次内存，再把头部和参数直接序列化进去，
+ *          避免先序列化到各自的字符串再拼接带来的重新分配和整段拷贝
+ */
+void KrpcClientConnection::EncodeRequest(Krpc::RpcHeader *header, const google::protobuf::Message *request,
+                                         std::string *frame) {
+    // ByteSizeLong 会缓存计算结果，供后面的 SerializeWithCachedSizesToArray 使用
+    size_t args_size = request->ByteSizeLong();
+    header->set_args_size(static_cast<uint32_t>(args_size));
+    size_t header_size = header->ByteSizeLong();
+    size_t frame_size = google::protobuf::io::CodedOutputStream::VarintSize32(static_cast<uint32_t>(header_size))
+                        + header_size + args_size;
+
+    frame->resize(frame_size);
+    uint8_t *target = reinterpret_cast<uint8_t*>(&(*frame)[0]);
+    target = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(header_size), target);
+    target = header->SerializeWithCachedSizesToArray(target);
+    request->SerializeWithCachedSizesToArray(target);
+}
+
+/**
+ * @brief 将请求头和序列化好的请求参数编码为一个完整的请求帧
+ */
+void KrpcClientConnection::EncodeRequest(Krpc::RpcHeader *header, const std::string &args, std::string *frame) {
+    header->set_args_size(static_cast<uint32_t>(args.size()));
+    size_t header_size = header->ByteSizeLong();
+    frame->resize(google::protobuf::io::CodedOutputStream::VarintSize32(static_cast<uint32_t>(header_size))
+                  + header_size + args.size());
+    uint8_t *target = reinterpret_cast<uint8_t*>(&(*frame)[0]);
+    target = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(header_size), target);
+    target = header->SerializeWithCachedSizesToArray(target);
+    std::copy(args.begin(), args.end(), target);
+}
+
+/**
+ * @brief 编码取消帧 { header_size(varint32), RpcHeader:(request_id, cancel) }
+ */
+static void EncodeCancelFrame(uint64_t request_id, std::string *frame) {
+    Krpc::RpcHeader header;
+    header.set_request_id(request_id);
+    header.set_cancel(true);
+    size_t header_size = header.ByteSizeLong();
+    frame->resize(google::protobuf::io::CodedOutputStream::VarintSize32(static_cast<uint32_t>(header_size))
+                  + header_size);
+    uint8_t *target = reinterpret_cast<uint8_t*>(&(*frame)[0]);
+    target = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(header_size), target);
+    header.SerializeWithCachedSizesToArray(target);
+}
+
+/**
+ * @brief 构造函数
+ */
+KrpcClientConnection::KrpcClientConnection(const std::string &ip, uint16_t port, muduo::net::EventLoop *loop)
+        : m_key(ip + ":" + std::to_string(port)), m_loop(loop),
+          m_client(new muduo::net::TcpClient(loop, muduo::net::InetAddress(ip, port), "KrpcClient")),
+          m_nextId(1), m_broken(false) {
+}
+
+/**
+ * @brief 析构函数 在事件循环中关闭连接
+ * @details TcpClient 必须在它的事件循环线程中析构。
+ *          最后一个持有者可能正是事件循环中的响应回调，用 queueInLoop 推迟到本轮事件处理结束之后
+ */
+KrpcClientConnection::~KrpcClientConnection() {
+    muduo::net::TcpClient *client = m_client.release();
+    m_loop->queueInLoop([client]() {
+        delete client;
+    });
+}
+
+/**
+ * @brief 开始非阻塞地建立连接
+ * @details 回调只持有连接对象的弱引用，连接对象析构后到 TcpClient 真正释放之间的事件会被忽略
+ */
+void KrpcClientConnection::Start(int timeout_ms) {
+    std::weak_ptr<KrpcClientConnection> weak(shared_from_this());
+    m_client->setConnectionCallback([weak](const muduo::net::TcpConnectionPtr &conn) {
+        std::shared_ptr<KrpcClientConnection> self = weak.lock();
+        if(self) {
+            self->OnConnection(conn);
+        }
+    });
+    m_client->setMessageCallback([weak](const muduo::net::TcpConnectionPtr &conn,
+                                        muduo::net::Buffer *buffer, muduo::Timestamp) {
+        std::shared_ptr<KrpcClientConnection> self = weak.lock();
+        if(self) {
+            self->OnMessage(conn, buffer);
+        }
+    });
+    m_client->connect();
+    // TcpClient 连接失败时会一直重试，由这里的定时器决定什么时候放弃
+    m_loop->runAfter(timeout_ms / 1000.0, [weak]() {
+        std::shared_ptr<KrpcClientConnection> self = weak.lock();
+        if(self) {
+            self->OnConnectTimeout();
+        }
+    });
+}
+
+/**
+ * @brief 生成该连接上唯一的请求 id
+ */
+uint64_t KrpcClientConnection::NextRequestId() {
+    return m_nextId++;
+}
+
+/**
+ * @brief 在该连接上发起一次异步调用
+ * @details 连接已经出错时，cb 在当前线程中立即执行。
+ *          TcpConnection::send 是线程安全的，不在事件循环线程中调用时会把整个请求帧交给事件循环发送，
+ *          多个线程的请求帧不会交错
+ */
+void KrpcClientConnection::CallAsync(uint64_t request_id, const std::string &frame, int timeout_ms,
+                                     const ResponseCallback &cb) {
+    muduo::net::TcpConnectionPtr conn;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_broken) {
+            // 先登记再发送，避免响应先于登记到达
+            AddPendingLocked(request_id, timeout_ms, cb);
+            if(!m_conn) {
+                // 连接还没有建立，建立后统一发送
+                m_queued.push_back(std::make_pair(request_id, frame));
+                return;
+            }
+            conn = m_conn;
+        }
+    }
+    if(!conn) {
+        cb(Krpc::RPC_NETWORK_ERROR, nullptr, "connection broken");
+        return;
+    }
+    conn->send(frame);
+}
+
+/**
+ * @brief 在该连接上连续发起多次异步调用
+ * @details 连接已经出错时，所有回调在当前线程中立即执行
+ */
+void KrpcClientConnection::CallAsyncBatch(std::vector<OutgoingCall> *calls) {
+    size_t total_size = 0;
+    for(const auto &call : *calls) {
+        total_size += call.frame.size();
+    }
+    muduo::net::TcpConnectionPtr conn;
+    muduo::net::Buffer frames(total_size);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_broken) {
+            for(auto &call : *calls) {
+                AddPendingLocked(call.request_id, call.timeout_ms, call.cb);
+                if(!m_conn) {
+                    m_queued.push_back(std::make_pair(call.request_id, std::string()));
+                    m_queued.back().second.swap(call.frame);
+                } else {
+                    frames.append(call.frame);
+                }
+            }
+            if(!m_conn) {
+                return;
+            }
+            conn = m_conn;
+        }
+    }
+    if(!conn) {
+        for(auto &call : *calls) {
+            call.cb(Krpc::RPC_NETWORK_ERROR, nullptr, "connection broken");
+        }
+        return;
+    }
+    conn->send(&frames);
+}
+
+/**
+ * @brief 登记一次等待响应的调用并启动超时定时器
+ */
+void KrpcClientConnection::AddPendingLocked(uint64_t request_id, int timeout_ms, const ResponseCallback &cb) {
+    PendingCall &call = m_pending[request_id];
+    call.cb = cb;
+    call.has_timer = timeout_ms > 0;
+    if(call.has_timer) {
+        // 持有锁时注册定时器，定时器即使立即触发也要等登记完成后才能查找到该调用
+        std::weak_ptr<KrpcClientConnection> weak(shared_from_this());
+        call.timer = m_loop->runAfter(timeout_ms / 1000.0, [weak, request_id]() {
+            std::shared_ptr<KrpcClientConnection> self = weak.lock();
+            if(self) {
+                self->OnCallTimeout(request_id);
+            }
+        });
+    }
+}
+
+/**
+ * @brief 取消一次尚未完成的调用
+ */
+void KrpcClientConnection::Cancel(uint64_t request_id) {
+    ResponseCallback cb;
+    muduo::net::TcpConnectionPtr conn;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_pending.find(request_id);
+        if(it == m_pending.end()) {
+            return;  // 调用已经结束
+        }
+        cb.swap(it->second.cb);
+        if(it->second.has_timer) {
+            m_loop->cancel(it->second.timer);
+        }
+        m_pending.erase(it);
+        // 请求还没有发出，从待发送队列中移除即可，服务端不会知道这次调用
+        auto qit = std::find_if(m_queued.begin(), m_queued.end(),
+                                [request_id](const std::pair<uint64_t, std::string> &item) {
+                                    return item.first == request_id;
+                                });
+        if(qit != m_queued.end()) {
+            m_queued.erase(qit);
+        } else {
+            conn = m_conn;
+        }
+    }
+    if(conn) {
+        std::string frame;
+        EncodeCancelFrame(request_id, &frame);
+        conn->send(frame);
+    }
+    cb(Krpc::RPC_CANCELED, nullptr, "rpc canceled");
+}
+
+/**
+ * @brief 连接是否已经出错
+ */
+bool KrpcClientConnection::IsBroken() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_broken;
+}
+
+/**
+ * @brief 连接建立或断开
+ */
+void KrpcClientConnection::OnConnection(const muduo::net::TcpConnectionPtr &conn) {
+    if(!conn->connected()) {
+        FailAll(Krpc::RPC_NETWORK_ERROR, "server closed connection");
+        return;
+    }
+    // 长连接上是一问一答的小包，关闭 Nagle 算法避免请求被延迟发送
+    conn->setTcpNoDelay(true);
+    std::vector<std::pair<uint64_t, std::string>> queued;
+    bool broken = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        broken = m_broken;
+        if(!broken) {
+            m_conn = conn;
+            queued.swap(m_queued);
+        }
+    }
+    if(broken) {
+        // 建立连接已经超时，调用都已经失败
+        conn->forceClose();
+        return;
+    }
+    /// 发送连接建立之前缓存的请求帧，拼接在一起一次发出
+    muduo::net::Buffer frames;
+    for(const auto &item : queued) {
+        frames.append(item.second);
+    }
+    if(frames.readableBytes() > 0) {
+        conn->send(&frames);
+    }
+}
+
+/**
+ * @brief 收到数据
+ * @details 一次 read 可能读到多个响应帧或半个响应帧，多余的数据留在 muduo 的输入缓冲区中等下一次读事件
+ */
+void KrpcClientConnection::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer) {
+    while(true) {
+        uint64_t id = 0;
+        int status = Krpc::RPC_OK;
+        std::string body;
+        std::string err;
+        int ret = DecodeFrame(buffer, &id, &status, &body, &err);
+        if(ret == 0) {
+            break;
+        } else if(ret < 0) {
+            buffer->retrieveAll();
+            FailAll(Krpc::RPC_NETWORK_ERROR, err);
+            return;
+        }
+        ResponseCallback cb;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_pending.find(id);
+            if(it != m_pending.end()) {
+                cb.swap(it->second.cb);
+                if(it->second.has_timer) {
+                    m_loop->cancel(it->second.timer);
+                }
+                m_pending.erase(it);
+            }
+        }
+        if(!cb) {
+            // 调用已经超时，迟到的响应直接丢弃
+            LOG(INFO) << "drop response of finished request " << id << " from " << m_key;
+            continue;
+        }
+        // 回调在锁外执行，回调中可以在本连接上发起新的异步调用
+        // 服务端返回的框架错误（例如方法不存在）同样立即结束调用，不必等到超时
+        cb(status, &body, err);
+    }
+}
+
+/**
+ * @brief 建立连接超时
+ */
+void KrpcClientConnection::OnConnectTimeout() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_conn || m_broken) {
+            return;
+        }
+    }
+    FailAll(Krpc::RPC_NETWORK_ERROR, "connect timeout");
+}
+
+/**
+ * @brief 调用超时
+ * @details 只移除该调用，连接继续供其他调用使用，之后收到的该调用的响应会被丢弃
+ */
+void KrpcClientConnection::OnCallTimeout(uint64_t request_id) {
+    ResponseCallback cb;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_pending.find(request_id);
+        if(it == m_pending.end()) {
+            return;
+        }
+        cb.swap(it->second.cb);
+        m_pending.erase(it);
+    }
+    cb(Krpc::RPC_TIMEOUT, nullptr, "rpc timeout");
+}
+
+/**
+ * @brief 从读缓冲区中解码一个响应帧
+ */
+int KrpcClientConnection::DecodeFrame(muduo::net::Buffer *buffer, uint64_t *request_id, int *status,
+                                      std::string *body, std::string *err) {
+    const char *data = buffer->peek();
+    size_t readable = buffer->readableBytes();
+    if(readable == 0) {
+        return 0;
+    }
+
+    /// 解析 varint32 编码的头部长度
+    google::protobuf::io::CodedInputStream coded_input(reinterpret_cast<const uint8_t*>(data), readable);
+    uint32_t header_size = 0;
+    if(!coded_input.ReadVarint32(&header_size)) {
+        // varint32 最多 5 个字节，不足 5 个字节时可能只是还没收全
+        if(readable < 5) {
+            return 0;
+        }
+        *err = "invalid response header size";
+        return -1;
+    }
+    if(header_size > kMaxHeaderSize) {
+        *err = "response header too large";
+        return -1;
+    }
+    size_t header_offset = coded_input.CurrentPosition();
+    if(readable < header_offset + header_size) {
+        return 0;
+    }
+
+    /// 解析响应头
+    Krpc::RpcResponseHeader header;
+    if(!header.ParseFromArray(data + header_offset, header_size)) {
+        *err = "parse response header error";
+        return -1;
+    }
+    if(header.body_size() > kMaxBodySize) {
+        *err = "response too large";
+        return -1;
+    }
+    size_t frame_size = header_offset + header_size + header.body_size();
+    if(readable < frame_size) {
+        // 一次性预留出整个响应帧需要的空间，避免大响应在读取过程中多次扩容
+        buffer->ensureWritableBytes(frame_size - readable);
+        return 0;
+    }
+
+    /// 取出调用状态和响应消息体，并从缓冲区中移除整个响应帧
+    *request_id = header.request_id();
+    *status = header.status();
+    if(*status != Krpc::RPC_OK) {
+        *err = header.error_text();
+    }
+    body->assign(data + header_offset + header_size, header.body_size());
+    buffer->retrieve(frame_size);
+    return 1;
+}
+
+/**
+ * @brief 连接出错，关闭连接，所有等待中的调用都以失败结束
+ */
+void KrpcClientConnection::FailAll(int status, const std::string &err) {
+    std::unordered_map<uint64_t, PendingCall> pending;
+    muduo::net::TcpConnectionPtr conn;
+    bool first = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        first = !m_broken;
+        m_broken = true;
+        conn = m_conn;
+        m_queued.clear();
+        pending.swap(m_pending);
+    }
+    if(first) {
+        LOG(ERROR) << "connection " << m_key << " broken: " << err;
+        if(conn) {
+            conn->forceClose();
+        } else {
+            m_client->stop();  // 停止重试建立连接
+        }
+    }
+    for(auto &p : pending) {
+        if(p.second.has_timer) {
+            m_loop->cancel(p.second.timer);
+        }
+        p.second.cb(status, nullptr, err);
+    }
+}
@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ClientReactor.cpp
+  * @author         : 18483
+  * @brief          : 客户端事件循环实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_ClientReactor.h"
+#include "Krpc_Application.h"
+#include <cstdlib>
+#include <string>
+
+/**
+ * @brief 获取全局唯一的客户端事件循环组
+ */
+KrpcClientReactor &KrpcClientReactor::GetInstance() {
+    static KrpcClientReactor reactor;
+    return reactor;
+}
+
+/**
+ * @brief 构造函数 启动 client_io_threads 个事件循环线程
+ * @details 没有使用 muduo 的 EventLoopThreadPool：它的 getNextLoop 只能在 baseLoop 线程中调用，
+ *          而客户端连接是在各个业务线程中创建的
+ */
+KrpcClientReactor::KrpcClientReactor() : m_next(0) {
+    int thread_num = atoi(KrpcApplication::GetInstance().GetConfig().Load("client_io_threads").c_str());
+    if(thread_num <= 0) {
+        thread_num = 1;
+    }
+    for(int i = 0; i < thread_num; ++i) {
+        std::unique_ptr<muduo::net::EventLoopThread> thread(
+                new muduo::net::EventLoopThread(muduo::net::EventLoopThread::ThreadInitCallback(),
+                                                "KrpcClient" + std::to_string(i)));
+        m_loops.push_back(thread->startLoop());
+        m_threads.push_back(std::move(thread));
+    }
+}
+
+/**
+ * @brief 为新连接选择一个事件循环
+ */
+muduo::net::EventLoop *KrpcClientReactor::GetNextLoop() {
+    return m_loops[m_next++ % m_loops.size()];
+}
@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ConnectionPool.cpp
+  * @author         : 18483
+  * @brief          : 客户端长连接池实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_ConnectionPool.h"
+#include "Krpc_Application.h"
+#include "Krpc_ClientReactor.h"
+#include "Krpc_Logger.h"
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * @brief 从配置文件读取一个正整数，未配置或非法时使用默认值
+ */
+static int LoadPositiveInt(const std::string &key, int default_value) {
+    std::string value = KrpcApplication::GetInstance().GetConfig().Load(key);
+    int n = atoi(value.c_str());
+    return n > 0 ? n : default_value;
+}
+
+/**
+ * @brief 获取全局唯一的连接池
+ * @details C++11 保证局部静态变量的初始化是线程安全的
+ */
+KrpcConnectionPool &KrpcConnectionPool::GetInstance() {
+    static KrpcConnectionPool pool;
+    return pool;
+}
+
+/**
+ * @brief 构造函数 从配置文件中读取连接池参数
+ */
+KrpcConnectionPool::KrpcConnectionPool()
+        : m_maxIdle(LoadPositiveInt("pool_max_idle", 2)),
+          m_maxActive(LoadPositiveInt("pool_max_active", 8)),
+          m_maxInflight(LoadPositiveInt("pool_max_inflight", 256)),
+          m_connectTimeoutMs(LoadPositiveInt("connect_timeout_ms", 1000)) {
+    // 连接析构时需要在事件循环中释放 TcpClient，让事件循环先于连接池构造完成，从而在连接池之后析构
+    KrpcClientReactor::GetInstance();
+    if(m_maxIdle > m_maxActive) {
+        m_maxIdle = m_maxActive;
+    }
+}
+
+/**
+ * @brief 选出在途请求最少的连接
+ */
+KrpcConnectionPool::Slot *KrpcConnectionPool::LeastLoaded(std::vector<Slot> &slots) {
+    Slot *best = nullptr;
+    for(auto &slot : slots) {
+        if(best == nullptr || slot.inflight < best->inflight) {
+            best = &slot;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief 从连接池中取出一个到 ip:port 的可用连接
+ */
+std::shared_ptr<KrpcClientConnection> KrpcConnectionPool::Acquire(const std::string &ip, uint16_t port) {
+    std::string key = ip + ":" + std::to_string(port);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Endpoint &ep = m_endpoints[key];
+
+    /// 丢弃已经出错的连接，对端关闭的空闲连接会被事件循环及时发现并标记为出错
+    ep.slots.erase(std::remove_if(ep.slots.begin(), ep.slots.end(),
+                                  [](const Slot &slot) { return slot.conn->IsBroken(); }),
+                   ep.slots.end());
+    /// 优先选择在途请求最少的连接
+    Slot *best = LeastLoaded(ep.slots);
+
+    /// 没有连接，或者所有连接都已经很忙，并且连接数未达上限时新建连接
+    if((best == nullptr || best->inflight >= m_maxInflight) && ep.slots.size() < m_maxActive) {
+        // 连接在事件循环中非阻塞地建立，建立之前发起的调用会先缓存起来，这里不需要等待
+        Slot slot;
+        slot.conn = std::make_shared<KrpcClientConnection>(ip, port, KrpcClientReactor::GetInstance().GetNextLoop());
+        slot.conn->Start(m_connectTimeoutMs);
+        slot.inflight = 1;
+        ep.slots.push_back(slot);
+        return slot.conn;
+    }
+    if(best == nullptr) {
+        return nullptr;
+    }
+    ++best->inflight;
+    return best->conn;
+}
+
+/**
+ * @brief 调用结束后归还连接
+ */
+void KrpcConnectionPool::Release(const std::shared_ptr<KrpcClientConnection> &conn) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_endpoints.find(conn->Key());
+    if(it == m_endpoints.end()) {
+        return;
+    }
+    std::vector<Slot> &slots = it->second.slots;
+    auto sit = std::find_if(slots.begin(), slots.end(),
+                            [&conn](const Slot &slot) { return slot.conn == conn; });
+    if(sit == slots.end()) {
+        return;  // 连接已经被丢弃
+    }
+    if(sit->inflight > 0) {
+        --sit->inflight;
+    }
+    // 出错的连接直接丢弃，最后一个持有者释放时关闭 socket
+    if(conn->IsBroken()) {
+        slots.erase(sit);
+        return;
+    }
+    // 空闲连接数超过上限时关闭多余的连接
+    if(sit->inflight == 0) {
+        size_t idle = std::count_if(slots.begin(), slots.end(),
+                                    [](const Slot &slot) { return slot.inflight == 0; });
+        if(idle > m_maxIdle) {
+            slots.erase(sit);
+        }
+    }
+}
+
+/**
+ * @brief 到 ip:port 的所有连接上的在途请求总数
+ */
+size_t KrpcConnectionPool::InFlight(const std::string &ip, uint16_t port) {
+    std::string key = ip + ":" + std::to_string(port);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_endpoints.find(key);
+    if(it == m_endpoints.end()) {
+        return 0;
+    }
+    size_t inflight = 0;
+    for(const auto &slot : it->second.slots) {
+        inflight += slot.inflight;
+    }
+    return inflight;
+}
@@ -9,6 +9,7 @@
   */
 
 #include "Krpc_Controller.h"
+#include "Krpcheader.pb.h"
 
 /**
  * @brief 构造函数 初始化控制器状态
@@ -16,6 +17,10 @@
 KrpcController::KrpcController() {
     m_failed = false;  // 初始状态为 未失败
     m_errText = "";    // 错误信息初始为空
+    m_errCode = Krpc::RPC_OK;
+    m_timeoutMs = 0;   // 未设置超时时间
+    m_canceled = false;
+    m_cancelCallback = nullptr;
 }
 
 /**
@@ -24,6 +29,12 @@ KrpcController::KrpcController() {
 void KrpcController::Reset() {
     m_failed = false;
     m_errText = "";
+    m_errCode = Krpc::RPC_OK;
+    m_timeoutMs = 0;
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    m_canceled = false;
+    m_cancelCallback = nullptr;
+    m_cancelHook = nullptr;
 }
 
 /**
@@ -44,23 +55,126 @@ std::string KrpcController::ErrorText() const {
  * @brief 设置 RPC 调用失败，并记录失败原因
  */
 void KrpcController::SetFailed(const std::string &reason) {
+    SetFailed(Krpc::RPC_SERVICE_ERROR, reason);
+}
+
+/**
+ * @brief 获取错误码
+ */
+int KrpcController::ErrorCode() const {
+    return m_errCode;
+}
+
+/**
+ * @brief 设置 RPC 调用失败，并记录错误码和失败原因
+ */
+void KrpcController::SetFailed(int code, const std::string &reason) {
     m_failed = true;     // 设置失败标志
     m_errText = reason;  // 记录失败原因
+    m_errCode = code;
 }
 
+/**
+ * @brief 设置本次调用的超时时间
+ */
+void KrpcController::SetTimeout(int timeout_ms) {
+    m_timeoutMs = timeout_ms > 0 ? timeout_ms : 0;
+}
+
+/**
+ * @brief 获取本次调用的超时时间
+ */
+int KrpcController::GetTimeout() const {
+    return m_timeoutMs;
+}
 
-/// 以下功能未实现，是RPC服务端提供的取消功能
-// 开始取消RPC调用（未实现）
+
+/**
+ * @brief 客户端取消调用
+ * @details hook 和回调都在锁外执行，它们可能会再次访问控制器
+ */
 void KrpcController::StartCancel() {
-    // 目前为空，未实现具体功能
+    std::function<void()> hook;
+    google::protobuf::Closure *callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        if(m_canceled) {
+            return;
+        }
+        m_canceled = true;
+        hook.swap(m_cancelHook);
+        callback = m_cancelCallback;
+        m_cancelCallback = nullptr;
+    }
+    if(hook) {
+        hook();
+    }
+    if(callback != nullptr) {
+        callback->Run();
+    }
 }
 
-// 判断RPC调用是否被取消（未实现）
+/**
+ * @brief 判断调用是否已被取消
+ */
 bool KrpcController::IsCanceled() const {
-    return false;  // 默认返回false，表示未被取消
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    return m_canceled;
 }
 
-// 注册取消回调函数（未实现）
+/**
+ * @brief 注册取消回调
+ */
 void KrpcController::NotifyOnCancel(google::protobuf::Closure* callback) {
-    // 目前为空，未实现具体功能
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        if(!m_canceled) {
+            m_cancelCallback = callback;
+            return;
+        }
+    }
+    callback->Run();
+}
+
+/**
+ * @brief 设置客户端取消调用的动作
+ */
+void KrpcController::SetCancelHook(const std::function<void()> &hook) {
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        if(!m_canceled || !hook) {
+            m_cancelHook = hook;
+            return;
+        }
+    }
+    hook();
+}
+
+/**
+ * @brief 取出 NotifyOnCancel 注册的回调
+ */
+google::protobuf::Closure* KrpcController::TakeCancelCallback(bool cancel) {
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    if(cancel) {
+        m_canceled = true;
+    }
+    google::protobuf::Closure *callback = m_cancelCallback;
+    m_cancelCallback = nullptr;
+    return callback;
+}
+
+/**
+ * @brief 以错误码和原因结束一次客户端调用
+ */
+void KrpcController::FailCall(google::protobuf::RpcController *controller, google::protobuf::Closure *done,
+                              int code, const std::string &reason) {
+    KrpcController *krpc_controller = dynamic_cast<KrpcController*>(controller);
+    if(krpc_controller != nullptr) {
+        krpc_controller->SetFailed(code, reason);
+    } else {
+        controller->SetFailed(reason);
+    }
+    if(done != nullptr) {
+        done->Run();
+    }
 }
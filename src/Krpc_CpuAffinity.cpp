@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_CpuAffinity.cpp
+  * @author         : 18483
+  * @brief          : 线程 CPU 亲和性设置实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_CpuAffinity.h"
+#include "Krpc_Logger.h"
+#include <cctype>
+#include <cstdlib>
+#include <pthread.h>
+#include <sched.h>
+
+/**
+ * @brief 解析 CPU 列表
+ */
+bool KrpcCpuAffinity::ParseCpuList(const std::string &text, std::vector<int> *cpus) {
+    cpus->clear();
+    size_t start = 0;
+    while(start < text.size()) {
+        size_t end = text.find(',', start);
+        if(end == std::string::npos) {
+            end = text.size();
+        }
+        std::string item = text.substr(start, end - start);
+        start = end + 1;
+        if(item.empty()) {
+            continue;
+        }
+        /// 单个 CPU "n" 或 范围 "a-b"，strtol 会跳过空白和正负号，每个数字之前先确认是数字
+        if(!isdigit(static_cast<unsigned char>(item[0]))) {
+            cpus->clear();
+            return false;
+        }
+        char *pos = nullptr;
+        long first = strtol(item.c_str(), &pos, 10);
+        long last = first;
+        if(*pos == '-') {
+            if(!isdigit(static_cast<unsigned char>(pos[1]))) {
+                cpus->clear();
+                return false;
+            }
+            last = strtol(pos + 1, &pos, 10);
+        }
+        if(*pos != '\0' || last < first || last >= CPU_SETSIZE) {
+            cpus->clear();
+            return false;
+        }
+        for(long cpu = first; cpu <= last; ++cpu) {
+            cpus->push_back(static_cast<int>(cpu));
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 把当前线程绑定到一个 CPU 上
+ */
+void KrpcCpuAffinity::PinCurrentThread(const std::vector<int> &cpus, size_t index) {
+    if(cpus.empty()) {
+        return;
+    }
+    int cpu = cpus[index % cpus.size()];
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if(ret != 0) {
+        KrpcLogger::Warning("pthread_setaffinity_np to cpu " + std::to_string(cpu) + " failed");
+    }
+}
@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_LoadBalancer.cpp
+  * @author         : 18483
+  * @brief          : 客户端负载均衡策略实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_LoadBalancer.h"
+#include "Krpc_Application.h"
+#include "Krpc_ConnectionPool.h"
+#include <random>
+
+/**
+ * @brief 每个线程独立的随机数引擎，避免多线程竞争同一个引擎
+ */
+static std::mt19937 &LocalEngine() {
+    static thread_local std::mt19937 engine(std::random_device{}());
+    return engine;
+}
+
+/**
+ * @brief 根据策略名创建负载均衡策略
+ */
+std::shared_ptr<KrpcLoadBalancer> KrpcLoadBalancer::Create(const std::string &policy) {
+    if(policy == "random") {
+        return std::make_shared<KrpcWeightedRandomBalancer>();
+    } else if(policy == "p2c") {
+        return std::make_shared<KrpcP2CBalancer>();
+    }
+    return std::make_shared<KrpcRoundRobinBalancer>();
+}
+
+/**
+ * @brief 进程默认的负载均衡策略
+ * @details 轮询的计数需要在所有 Channel 之间共享，否则每个新建的 Channel 都会从第一个实例开始
+ */
+std::shared_ptr<KrpcLoadBalancer> KrpcLoadBalancer::Default() {
+    static std::shared_ptr<KrpcLoadBalancer> balancer =
+            Create(KrpcApplication::GetInstance().GetConfig().Load("loadbalance"));
+    return balancer;
+}
+
+/**
+ * @brief 轮询
+ */
+const KrpcServiceInstance &KrpcRoundRobinBalancer::Select(const std::vector<KrpcServiceInstance> &instances) {
+    return instances[m_next++ % instances.size()];
+}
+
+/**
+ * @brief 加权随机
+ */
+const KrpcServiceInstance &KrpcWeightedRandomBalancer::Select(const std::vector<KrpcServiceInstance> &instances) {
+    int total = 0;
+    for(const auto &instance : instances) {
+        total += instance.weight;
+    }
+    std::uniform_int_distribution<int> dist(0, total - 1);
+    int n = dist(LocalEngine());
+    for(const auto &instance : instances) {
+        n -= instance.weight;
+        if(n < 0) {
+            return instance;
+        }
+    }
+    return instances.back();
+}
+
+/**
+ * @brief 二选一
+ */
+const KrpcServiceInstance &KrpcP2CBalancer::Select(const std::vector<KrpcServiceInstance> &instances) {
+    if(instances.size() == 1) {
+        return instances[0];
+    }
+    /// 随机选出两个不同的实例：b 从除 a 以外的 n - 1 个实例中均匀选取
+    std::uniform_int_distribution<size_t> dist_a(0, instances.size() - 1);
+    std::uniform_int_distribution<size_t> dist_b(0, instances.size() - 2);
+    size_t a = dist_a(LocalEngine());
+    size_t b = dist_b(LocalEngine());
+    if(b >= a) {
+        ++b;
+    }
+    const KrpcServiceInstance &x = instances[a];
+    const KrpcServiceInstance &y = instances[b];
+    /// 比较单位权重上的在途请求数：x.inflight / x.weight 与 y.inflight / y.weight
+    KrpcConnectionPool &pool = KrpcConnectionPool::GetInstance();
+    size_t x_load = pool.InFlight(x.ip, x.port) * y.weight;
+    size_t y_load = pool.InFlight(y.ip, y.port) * x.weight;
+    if(x_load != y_load) {
+        return x_load < y_load ? x : y;
+    }
+    return x.weight >= y.weight ? x : y;
+}
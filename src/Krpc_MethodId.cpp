@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_MethodId.cpp
+  * @author         : 18483
+  * @brief          : RPC 方法的数字 id 实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_MethodId.h"
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief 方法全名的 32 位 FNV-1a 哈希，0 映射为 1
+ */
+static uint32_t Hash(const std::string &name) {
+    uint32_t hash = 2166136261u;
+    for(unsigned char c : name) {
+        hash ^= c;
+        hash *= 16777619u;
+    }
+    return hash != 0 ? hash : 1;
+}
+
+/**
+ * @brief 方法的数字 id
+ * @details MethodDescriptor 在进程内一直有效，每个方法只在第一次使用时计算一次哈希
+ */
+uint32_t KrpcMethodId::Of(const google::protobuf::MethodDescriptor *method) {
+    static std::mutex mutex;
+    static std::unordered_map<const google::protobuf::MethodDescriptor*, uint32_t> ids;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = ids.find(method);
+    if(it == ids.end()) {
+        it = ids.emplace(method, Hash(method->full_name())).first;
+    }
+    return it->second;
+}
@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_MicroBatcher.cpp
+  * @author         : 18483
+  * @brief          : 客户端自动攒批实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_MicroBatcher.h"
+#include "Krpc_ClientReactor.h"
+#include "Krpc_ConnectionPool.h"
+#include "Krpc_Controller.h"
+#include "Krpc_Logger.h"
+#include "Krpc_MethodId.h"
+#include "Krpcheader.pb.h"
+#include <google/protobuf/message.h>
+#include <algorithm>
+
+/**
+ * @brief 获取全局唯一的攒批器
+ */
+KrpcMicroBatcher &KrpcMicroBatcher::GetInstance() {
+    static KrpcMicroBatcher batcher;
+    return batcher;
+}
+
+/**
+ * @brief 构造函数
+ */
+KrpcMicroBatcher::KrpcMicroBatcher() : m_nextId(1) {
+}
+
+/**
+ * @brief 加入一个异步调用
+ * @details 请求参数在加锁前序列化；没有该实例的窗口时在调用线程中从连接池取出连接并开启窗口。
+ *          调用数达到上限时由当前线程发送，否则由 linger 定时器在事件循环线程中发送。
+ *          先注册调用的 cancel hook 和超时定时器，之后才加入窗口；已经结束的调用留在窗口中，发送时跳过
+ */
+void KrpcMicroBatcher::Add(const std::string &ip, uint16_t port,
+                           const google::protobuf::MethodDescriptor *method,
+                           google::protobuf::RpcController *controller,
+                           const google::protobuf::Message *request,
+                           google::protobuf::Message *response,
+                           google::protobuf::Closure *done,
+                           int timeout_ms, int linger_us, size_t max_batch) {
+    std::shared_ptr<Call> call = std::make_shared<Call>();
+    call->entry.controller = controller;
+    call->entry.response = response;
+    call->entry.done = done;
+    call->controller = dynamic_cast<KrpcController*>(controller);
+    call->method_id = KrpcMethodId::Of(method);
+    request->SerializeToString(&call->args);
+    call->has_deadline = timeout_ms > 0;
+    call->deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    call->loop = nullptr;
+    call->finished = false;
+
+    /// 调用自己的取消和超时，与窗口中的其他调用无关。加入窗口前注册好，加入之后调用随时可能被其他线程发出并结束；
+    /// hook 和定时器只持有弱引用。先注册 hook：调用一旦结束，done 执行后控制器可能已经被释放，之后不能再访问
+    std::weak_ptr<Call> weak_call(call);
+    if(call->controller != nullptr) {
+        // 已经取消时立即执行
+        call->controller->SetCancelHook([weak_call]() {
+            std::shared_ptr<Call> c = weak_call.lock();
+            if(c) {
+                Finish(c, Krpc::RPC_CANCELED, "rpc canceled", nullptr, false);
+            }
+        });
+    }
+    if(call->has_deadline) {
+        std::lock_guard<std::mutex> lock(call->mutex);
+        if(!call->finished) {
+            call->loop = KrpcClientReactor::GetInstance().GetNextLoop();
+            call->timer = call->loop->runAfter(timeout_ms / 1000.0, [weak_call]() {
+                std::shared_ptr<Call> c = weak_call.lock();
+                if(c) {
+                    Finish(c, Krpc::RPC_TIMEOUT, "rpc timeout", nullptr, true);
+                }
+            });
+        }
+    }
+
+    std::string key = ip + ":" + std::to_string(port);
+    std::unique_ptr<Window> full;
+    bool connect_failed = false;
+    bool arm_timer = false;
+    uint64_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_windows.find(key);
+        if(it == m_windows.end()) {
+            // 开启新的攒批窗口，连接池只在调用线程中访问，连接在事件循环中非阻塞地建立
+            std::shared_ptr<KrpcClientConnection> conn = KrpcConnectionPool::GetInstance().Acquire(ip, port);
+            if(conn) {
+                std::unique_ptr<Window> window(new Window());
+                window->id = m_nextId++;
+                window->conn = conn;
+                id = window->id;
+                arm_timer = true;
+                it = m_windows.emplace(key, std::move(window)).first;
+            } else {
+                connect_failed = true;
+            }
+        }
+        if(!connect_failed) {
+            Window &window = *it->second;
+            window.calls.push_back(call);
+            if(window.calls.size() >= max_batch) {
+                full.swap(it->second);
+                m_windows.erase(it);
+                arm_timer = false;
+            }
+        }
+    }
+    if(connect_failed) {
+        // done 不能在持有锁时执行
+        LOG(ERROR) << "connect server error";
+        Finish(call, Krpc::RPC_NETWORK_ERROR, "connect server error!", nullptr, false);
+        return;
+    }
+    if(arm_timer) {
+        KrpcClientReactor::GetInstance().GetNextLoop()->runAfter(linger_us / 1000000.0, [key, id]() {
+            KrpcMicroBatcher::GetInstance().OnLinger(key, id);
+        });
+    }
+    if(full) {
+        Send(std::move(full));
+    }
+}
+
+/**
+ * @brief linger 定时器到期
+ * @details 窗口已经因为调用数达到上限而提前发送时忽略
+ */
+void KrpcMicroBatcher::OnLinger(const std::string &key, uint64_t id) {
+    std::unique_ptr<Window> window;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_windows.find(key);
+        if(it == m_windows.end() || it->second->id != id) {
+            return;
+        }
+        window.swap(it->second);
+        m_windows.erase(it);
+    }
+    Send(std::move(window));
+}
+
+/**
+ * @brief 发送一个已经关闭的窗口
+ * @details 只编码请求头和批量请求，交给开启窗口时取出的连接发送；批量请求结束后归还连接并拆分结果。
+ *          批量请求的超时时间取仍在等待的调用中最晚的截止时间，有不限时的调用时不限时，
+ *          更早到期的调用由各自的定时器结束
+ */
+void KrpcMicroBatcher::Send(std::unique_ptr<Window> window) {
+    std::shared_ptr<std::vector<std::shared_ptr<Call>>> calls =
+            std::make_shared<std::vector<std::shared_ptr<Call>>>();
+    calls->reserve(window->calls.size());
+    Krpc::RpcBatchRequest request;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point latest = now;
+    bool unlimited = false;
+    for(auto &call : window->calls) {
+        if(call->finished) {
+            continue;
+        }
+        if(call->has_deadline && call->deadline <= now) {
+            Finish(call, Krpc::RPC_TIMEOUT, "rpc timeout", nullptr, false);
+            continue;
+        }
+        if(call->has_deadline) {
+            latest = std::max(latest, call->deadline);
+        } else {
+            unlimited = true;
+        }
+        Krpc::RpcBatchEntry *batch_entry = request.add_entries();
+        batch_entry->set_method_id(call->method_id);
+        batch_entry->mutable_args()->swap(call->args);
+        calls->push_back(call);
+    }
+    std::shared_ptr<KrpcClientConnection> conn = window->conn;
+    if(calls->empty()) {
+        KrpcConnectionPool::GetInstance().Release(conn);
+        return;
+    }
+
+    /// 把剩余的超时时间带给服务端，向上取整，不会比任何一个调用先放弃
+    Krpc::RpcHeader header;
+    header.set_batch(true);
+    int remaining_ms = 0;
+    if(!unlimited) {
+        remaining_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                latest - now + std::chrono::milliseconds(1) - std::chrono::nanoseconds(1)).count());
+        header.set_timeout_ms(remaining_ms);
+    }
+    uint64_t request_id = conn->NextRequestId();
+    header.set_request_id(request_id);
+    std::string frame;
+    KrpcClientConnection::EncodeRequest(&header, &request, &frame);
+
+    conn->CallAsync(request_id, frame, remaining_ms, [conn, calls](int status, std::string *body,
+                                                                   const std::string &err) {
+        KrpcConnectionPool::GetInstance().Release(conn);
+        if(status != Krpc::RPC_OK) {
+            LOG(ERROR) << "CALL error: " << err;
+            for(auto &call : *calls) {
+                Finish(call, status, err, nullptr, false);
+            }
+            return;
+        }
+        Krpc::RpcBatchResponse response;
+        if(!response.ParseFromString(*body)) {
+            LOG(ERROR) << "PARSE error: " << conn->Key();
+            for(auto &call : *calls) {
+                Finish(call, Krpc::RPC_BAD_RESPONSE, "parse response error!", nullptr, false);
+            }
+            return;
+        }
+        for(size_t i = 0; i < calls->size(); ++i) {
+            const Krpc::RpcBatchResult *result =
+                    static_cast<int>(i) < response.results_size() ? &response.results(static_cast<int>(i)) : nullptr;
+            Finish((*calls)[i], Krpc::RPC_OK, "", result, false);
+        }
+    });
+}
+
+/**
+ * @brief 结束一个调用
+ * @details 先清除 cancel hook 和超时定时器再执行 done，done 执行后控制器可能已经被释放
+ */
+void KrpcMicroBatcher::Finish(const std::shared_ptr<Call> &call, int status, const std::string &err,
+                              const Krpc::RpcBatchResult *result, bool from_timer) {
+    if(call->finished.exchange(true)) {
+        return;
+    }
+    if(call->controller != nullptr) {
+        call->controller->SetCancelHook(nullptr);
+    }
+    if(call->has_deadline && !from_timer) {
+        std::lock_guard<std::mutex> lock(call->mutex);
+        if(call->loop != nullptr) {
+            call->loop->cancel(call->timer);
+        }
+    }
+    // 取消与响应到达同时发生时，以取消为准
+    if(status == Krpc::RPC_OK && call->controller != nullptr && call->controller->IsCanceled()) {
+        KrpcController::FailCall(call->entry.controller, call->entry.done, Krpc::RPC_CANCELED, "rpc canceled");
+        return;
+    }
+    KrpcBatch::CompleteEntry(call->entry, status, err, result);
+}
@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_Pipeline.cpp
+  * @author         : 18483
+  * @brief          : 客户端请求流水线实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_Pipeline.h"
+#include "Krpcheader.pb.h"
+
+/**
+ * @brief 构造函数
+ */
+KrpcPipeline::KrpcPipeline(KrpcChannel *channel, size_t max_batch)
+        : m_channel(channel), m_maxBatch(max_batch), m_pending(0) {
+}
+
+/**
+ * @brief 析构函数 发送所有未发送的请求，保证每个调用的 done 都会被执行
+ */
+KrpcPipeline::~KrpcPipeline() {
+    Flush();
+}
+
+/**
+ * @brief 发起调用
+ * @details 同步调用要阻塞等待响应，先发送暂存的请求，避免它们被同步调用耽误
+ */
+void KrpcPipeline::CallMethod(const ::google::protobuf::MethodDescriptor *method,
+                              ::google::protobuf::RpcController *controller,
+                              const ::google::protobuf::Message *request,
+                              ::google::protobuf::Message *response,
+                              ::google::protobuf::Closure *done) {
+    if(done == nullptr) {
+        Flush();
+        m_channel->CallMethod(method, controller, request, response, nullptr);
+        return;
+    }
+    m_channel->StartCall(method, controller, request, response, done, this);
+}
+
+/**
+ * @brief 暂存一个请求
+ */
+void KrpcPipeline::Enqueue(const std::shared_ptr<KrpcClientConnection> &conn, const Krpc::RpcHeader &header,
+                           std::string *args, bool has_deadline, std::chrono::steady_clock::time_point deadline,
+                           const KrpcClientConnection::ResponseCallback &cb, KrpcController *controller) {
+    Batch *batch = nullptr;
+    for(auto &b : m_batches) {
+        if(b.conn == conn) {
+            batch = &b;
+            break;
+        }
+    }
+    if(batch == nullptr) {
+        m_batches.push_back(Batch());
+        batch = &m_batches.back();
+        batch->conn = conn;
+    }
+    Call call;
+    call.header = std::make_shared<Krpc::RpcHeader>(header);
+    call.args.swap(*args);
+    call.deadline = deadline;
+    call.has_deadline = has_deadline;
+    call.cb = cb;
+    call.controller = controller;
+    batch->calls.push_back(std::move(call));
+    ++m_pending;
+    if(m_maxBatch > 0 && m_pending >= m_maxBatch) {
+        Flush();
+    }
+}
+
+/**
+ * @brief 发送所有暂存的请求
+ * @details 先取出暂存的请求再发送，连接出错时回调会立即执行，回调中可以再次使用 pipeline。
+ *          调用在暂存期间还没有登记到连接上，cancel hook 找不到它，取消只会在控制器上留下标记：
+ *          发送前跳过已经取消的调用，登记之后再检查一次，补上发送过程中发生的取消。
+ *          剩余的超时时间在这里重新计算，暂存期间已经到期的调用不再发送
+ */
+void KrpcPipeline::Flush() {
+    std::vector<Batch> batches;
+    batches.swap(m_batches);
+    m_pending = 0;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for(auto &batch : batches) {
+        std::vector<KrpcClientConnection::OutgoingCall> calls;
+        std::vector<KrpcController*> controllers;
+        calls.reserve(batch.calls.size());
+        controllers.reserve(batch.calls.size());
+        for(auto &pending : batch.calls) {
+            if(pending.controller != nullptr && pending.controller->IsCanceled()) {
+                pending.cb(Krpc::RPC_CANCELED, nullptr, "rpc canceled");
+                continue;
+            }
+            int remaining_ms = 0;
+            if(pending.has_deadline) {
+                remaining_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                        pending.deadline - now).count());
+                if(remaining_ms <= 0) {
+                    pending.cb(Krpc::RPC_TIMEOUT, nullptr, "rpc timeout");
+                    continue;
+                }
+                pending.header->set_timeout_ms(remaining_ms);
+            }
+            KrpcClientConnection::OutgoingCall call;
+            call.request_id = pending.header->request_id();
+            KrpcClientConnection::EncodeRequest(pending.header.get(), pending.args, &call.frame);
+            call.timeout_ms = remaining_ms;
+            call.cb = pending.cb;
+            calls.push_back(std::move(call));
+            controllers.push_back(pending.controller);
+        }
+        if(calls.empty()) {
+            continue;
+        }
+        batch.conn->CallAsyncBatch(&calls);
+        for(size_t i = 0; i < calls.size(); ++i) {
+            // 调用已经结束时 Cancel 什么也不做
+            if(controllers[i] != nullptr && controllers[i]->IsCanceled()) {
+                batch.conn->Cancel(calls[i].request_id);
+            }
+        }
+    }
+}
@@ -12,7 +12,41 @@
 #include "Krpc_Application.h"
 #include "Krpcheader.pb.h"
 #include "Krpc_Provider.h"
+#include "Krpc_ThreadPool.h"
+#include "Krpc_WorkStealingPool.h"
+#include "Krpc_CpuAffinity.h"
+#include "Krpc_MethodId.h"
+#include <muduo/net/EventLoopThread.h>
+#include <algorithm>
 #include <iostream>
+#include <memory>
+#include <thread>
+
+/// 当前 IO 线程的编号，在 IO 线程启动时设置
+static thread_local size_t t_ioIndex = 0;
+
+/// 单个请求参数的最大长度，防止错误的长度字段导致无限制地缓存数据
+static const uint32_t kMaxArgsSize = 64 * 1024 * 1024;
+/// 请求头的最大长度，正常的请求头只有几十个字节
+static const uint32_t kMaxHeaderSize = 8 * 1024;
+/// 响应头中错误信息的最大长度，保证响应头不超过客户端允许的长度
+static const size_t kMaxErrorTextSize = 4 * 1024;
+
+/**
+ * @brief 一次批量请求的状态
+ * @details 批量请求中调用的 done 都在连接所在的 IO 线程中结束，因此这里的成员只在该线程中访问，不需要加锁
+ */
+struct KrpcProvider::BatchCall{
+    muduo::net::TcpConnectionPtr conn;
+    uint64_t request_id;
+    muduo::Timestamp deadline;
+    // 尚未结束的调用数
+    size_t remaining;
+    // 客户端已经取消了整个批量请求 或 断开了连接，不再发送响应
+    bool canceled;
+    // 批量响应，results 与请求中的 entries 一一对应
+    Krpc::RpcBatchResponse response;
+};
 
 /*
  *    service_map --> (service_name, service_info)
@@ -48,6 +82,25 @@ void KrpcProvider::NotifyService(google::protobuf::Service* service){
         std::cout << "method_name = " << method_name << std::endl;
         // 将方法名和方法描述存入 method_map
         service_info.method_map.emplace(method_name, pmd);
+        // 按方法 id 插入分发表，保持升序；不同方法的 id 冲突时客户端无法区分，直接退出
+        MethodEntry entry;
+        entry.id = KrpcMethodId::Of(pmd);
+        entry.service = service;
+        entry.method = pmd;
+        entry.request_prototype = &service->GetRequestPrototype(pmd);
+        entry.response_prototype = &service->GetResponsePrototype(pmd);
+        auto pos = std::lower_bound(method_table.begin(), method_table.end(), entry.id,
+                                    [](const MethodEntry &e, uint32_t id) { return e.id < id; });
+        if(pos != method_table.end() && pos->id == entry.id) {
+            if(pos->method != pmd) {
+                KrpcLogger::Fatal("method id conflict: " + pos->method->full_name() + " and " + pmd->full_name());
+            }
+            pos->service = service;  // 同一服务重复注册时使用新的服务对象
+            pos->request_prototype = entry.request_prototype;
+            pos->response_prototype = entry.response_prototype;
+        } else {
+            method_table.insert(pos, entry);
+        }
     }
     service_info.service = service;   // 保存服务对象
     service_map.emplace(service_name, service_info);  // 将服务名和服务信息存入 service_map
@@ -61,44 +114,129 @@ void KrpcProvider::Run() {
     // 读取配置文件中的 RPC 服务器 IP 和 端口
     std::string ip = KrpcApplication::GetInstance().GetConfig().Load("rpcserverip");
     int port = atoi(KrpcApplication::GetInstance().GetConfig().Load("rpcserverport").c_str());
+    // 每个线程缓存的调用上下文数量，未配置时使用默认值
+    std::string cache_size = KrpcApplication::GetInstance().GetConfig().Load("arena_cache_size");
+    if(!cache_size.empty()) {
+        int n = atoi(cache_size.c_str());
+        arena_cache_size = n > 0 ? n : 0;
+    }
+    // IO 线程数，auto 表示与 CPU 核数相同，未配置时为 4
+    std::string io_threads = KrpcApplication::GetInstance().GetConfig().Load("io_threads");
+    if(io_threads == "auto") {
+        io_thread_num = static_cast<int>(std::thread::hardware_concurrency());
+    } else if(!io_threads.empty()) {
+        io_thread_num = atoi(io_threads.c_str());
+    }
+    if(io_thread_num <= 0) {
+        io_thread_num = 4;
+    }
+    // IO 线程和业务线程绑定的 CPU，未配置时不绑核
+    std::vector<int> io_cpus;
+    std::vector<int> worker_cpus;
+    if(!KrpcCpuAffinity::ParseCpuList(KrpcApplication::GetInstance().GetConfig().Load("io_cpus"), &io_cpus)) {
+        KrpcLogger::Warning("invalid io_cpus, IO threads are not pinned");
+    }
+    if(!KrpcCpuAffinity::ParseCpuList(KrpcApplication::GetInstance().GetConfig().Load("worker_cpus"), &worker_cpus)) {
+        KrpcLogger::Warning("invalid worker_cpus, worker threads are not pinned");
+    }
+    // 业务线程池：服务方法中有磁盘或下游调用等阻塞操作时，避免阻塞 IO 线程上的其他连接
+    int worker_threads = atoi(KrpcApplication::GetInstance().GetConfig().Load("worker_threads").c_str());
+    if(worker_threads > 0) {
+        // 第 i 个工作线程绑定到 worker_cpus 中的第 i 个 CPU 上
+        KrpcExecutor::ThreadInitCallback worker_init = [worker_cpus](size_t index) {
+            KrpcCpuAffinity::PinCurrentThread(worker_cpus, index);
+        };
+        int queue_size = atoi(KrpcApplication::GetInstance().GetConfig().Load("worker_queue_size").c_str());
+        size_t max_queue_size = queue_size > 0 ? queue_size : 10000;
+        // queue: 所有工作线程共享一个队列；stealing: 每个工作线程一个队列，空闲时窃取其他线程的任务
+        if(KrpcApplication::GetInstance().GetConfig().Load("worker_executor") == "stealing") {
+            worker_pool.reset(new KrpcWorkStealingPool(worker_threads, max_queue_size, worker_init));
+        } else {
+            worker_pool.reset(new KrpcThreadPool(worker_threads, max_queue_size, worker_init));
+        }
+    }
     /**
      * @brief muduo 事件监听
      */
     // 使用muduo网络库，创建地址对象
     muduo::net::InetAddress address(ip, port);
-    // 创建TcpServer对象
-    std::shared_ptr<muduo::net::TcpServer> server = std::make_shared<muduo::net::TcpServer>(&event_loop, address, "KrpcProvider");
-    // 绑定连接回调和消息回调，分离网络连接业务和消息处理业务
-    server->setConnectionCallback(std::bind(&KrpcProvider::OnConnection, this, std::placeholders::_1));
-    server->setMessageCallback(std::bind(&KrpcProvider::OnMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-    // 设置muduo的线程数量
-    server->setThreadNum(4);
+    // IO 线程启动时编号，并绑定到 io_cpus 中对应的 CPU 上
+    muduo::net::EventLoopThread::ThreadInitCallback io_init = [this, io_cpus](muduo::net::EventLoop*) {
+        t_ioIndex = io_thread_counter++;
+        KrpcCpuAffinity::PinCurrentThread(io_cpus, t_ioIndex);
+    };
+    // 单 acceptor 模式：主事件循环负责 accept，再把连接轮流分给各个 IO 线程
+    std::shared_ptr<muduo::net::TcpServer> server;
+    // SO_REUSEPORT 模式：每个 IO 线程各自监听同一端口，由内核在各个监听 socket 之间分配新连接，
+    // 连接风暴时 accept 不再集中在主事件循环这一个线程上
+    std::vector<std::unique_ptr<muduo::net::EventLoopThread>> io_loops;
+    std::vector<std::unique_ptr<muduo::net::TcpServer>> acceptors;
+    bool reuse_port = KrpcApplication::GetInstance().GetConfig().Load("reuseport") == "true";
+    if(!reuse_port) {
+        // 创建TcpServer对象
+        server = std::make_shared<muduo::net::TcpServer>(&event_loop, address, "KrpcProvider");
+        // 绑定连接回调和消息回调，分离网络连接业务和消息处理业务
+        server->setConnectionCallback(std::bind(&KrpcProvider::OnConnection, this, std::placeholders::_1));
+        server->setMessageCallback(std::bind(&KrpcProvider::OnMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+        // 设置muduo的线程数量
+        server->setThreadNum(io_thread_num);
+        server->setThreadInitCallback(io_init);
+    } else {
+        for(int i = 0; i < io_thread_num; ++i) {
+            std::string name = "KrpcProvider" + std::to_string(i);
+            io_loops.emplace_back(new muduo::net::EventLoopThread(io_init, name));
+            muduo::net::EventLoop* loop = io_loops.back()->startLoop();
+            // 每个 TcpServer 不再创建自己的 IO 线程，接受的连接就在本事件循环中处理
+            std::unique_ptr<muduo::net::TcpServer> acceptor(
+                    new muduo::net::TcpServer(loop, address, name, muduo::net::TcpServer::kReusePort));
+            acceptor->setConnectionCallback(std::bind(&KrpcProvider::OnConnection, this, std::placeholders::_1));
+            acceptor->setMessageCallback(std::bind(&KrpcProvider::OnMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+            acceptors.push_back(std::move(acceptor));
+        }
+    }
     /**
-     * @brief zookeeper 服务注册 ，将 service_name 和 method_name 注册到 zookkeeper 服务器上
+     * @brief zookeeper 服务注册 ，将 service_name 和 本实例地址 注册到 zookkeeper 服务器上
      */
     // 将当前RPC节点上要发布的服务全部注册到 ZooKeeper 上，让 RPC 客户端可以在 ZooKeeper 上发现服务
     ZkClient zkclient;
     zkclient.Start();  // 连接zookeeper 服务器
-    /// server_name 为永久节点， method_name 为临时节点
+    // 实例权重，未配置时为 1
+    int weight = atoi(KrpcApplication::GetInstance().GetConfig().Load("rpcserverweight").c_str());
+    if(weight <= 0) {
+        weight = 1;
+    }
+    char instance_data[128] = {0};
+    sprintf(instance_data, "%s:%d:%d", ip.c_str(), port, weight); // 将IP、端口和权重信息存入节点数据
+    /// server_name 为永久节点，每个服务端实例在其下注册一个临时顺序节点
     for(auto &sp : service_map){
         // service_name 在 zookeeper 中的目录是 "/" + service_name <永久节点>
         std::string service_path = "/" + sp.first;
         // 创建服务节点
         zkclient.Create(service_path.c_str(), nullptr, 0);
-        for(auto &mp : sp.second.method_map){
-            // method_name 在ZooKeeper中的目录是"/" + service_name/method_name  <临时节点>
-            std::string method_path = service_path + "/" + mp.first;
-            char method_path_data[128] = {0};
-            sprintf(method_path_data, "%s:%d", ip.c_str(), port); // 将IP和端口信息存入节点数据
-            // ZOO_EPHEMERAL 表示这个节点是临时节点，在客户端断开连接后，ZooKeeper会自动删除这个节点
-            zkclient.Create(method_path.c_str(), method_path_data, strlen(method_path_data), ZOO_EPHEMERAL);
-        }
+        // 实例节点 "/" + service_name + "/instance-" + 序号 <临时顺序节点>
+        // ZOO_SEQUENCE 保证同一服务的多个实例节点名不会冲突，
+        // ZOO_EPHEMERAL 表示这个节点是临时节点，在服务端断开连接后，ZooKeeper会自动删除这个节点
+        std::string instance_path = service_path + "/instance-";
+        zkclient.Create(instance_path.c_str(), instance_data, strlen(instance_data), ZOO_EPHEMERAL | ZOO_SEQUENCE);
     }
     // RPC 服务端准备启动 打印信息
     std::cout << "RpcProvider start service at ip: " << ip << " port: " << port << std::endl;
     // 启动网络服务
-    server->start();
+    if(server) {
+        server->start();
+    } else {
+        // TcpServer::start 只能在它所属的事件循环中调用
+        for(auto &acceptor : acceptors) {
+            muduo::net::TcpServer* raw = acceptor.get();
+            raw->getLoop()->runInLoop([raw]() { raw->start(); });
+        }
+    }
     event_loop.loop(); // 开启事件循环
+    // TcpServer 只能在它所属的事件循环中析构，之后 IO 线程退出
+    for(auto &acceptor : acceptors) {
+        muduo::net::TcpServer* raw = acceptor.release();
+        raw->getLoop()->queueInLoop([raw]() { delete raw; });
+    }
 }
 
 /**
@@ -106,111 +244,622 @@ void KrpcProvider::Run() {
  * @param conn 连接
  */
 void KrpcProvider::OnConnection(const muduo::net::TcpConnectionPtr& conn){
-    if(!conn->connected()){
-        conn->shutdown();      // 如果连接关闭，则断开连接
+    if(conn->connected()) {
+        conn->setContext(std::make_shared<ConnectionState>());
+        return;
+    }
+    /// 客户端断开连接，正在处理的请求都不再需要响应，视为全部被取消
+    std::vector<google::protobuf::Closure*> callbacks;
+    ConnectionState *state = GetConnectionState(conn);
+    if(state != nullptr) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        for(auto &item : state->inflight) {
+            google::protobuf::Closure *callback = item.second->controller.TakeCancelCallback(true);
+            if(callback != nullptr) {
+                callbacks.push_back(callback);
+            }
+        }
+    }
+    // 取消回调可能会执行 done，必须在锁外执行
+    for(google::protobuf::Closure *callback : callbacks) {
+        callback->Run();
     }
+    conn->shutdown();      // 如果连接关闭，则断开连接
+}
+
+/**
+ * @brief 获取连接的状态
+ */
+KrpcProvider::ConnectionState* KrpcProvider::GetConnectionState(const muduo::net::TcpConnectionPtr& conn){
+    std::shared_ptr<ConnectionState> *state = boost::any_cast<std::shared_ptr<ConnectionState>>(conn->getMutableContext());
+    return state != nullptr ? state->get() : nullptr;
 }
 
 /**
  * @brief 消息回调函数，处理客户端发送的 RPC 请求
- * @details 从缓冲区读取并解析请求信息，获取请求中的 service 对象和 method 对象
+ * @details TCP 是字节流，一次回调时缓冲区中可能只有半个请求帧（等待下次数据到达），
+ *          也可能有多个连续的请求帧（客户端流水线发送 或 Nagle/GRO 合并），
+ *          这里先只解析帧长度，循环取出缓冲区中所有完整的请求帧逐个处理
  */
 void KrpcProvider::OnMessage(const muduo::net::TcpConnectionPtr& conn,
                muduo::net::Buffer* buffer, muduo::Timestamp receive_time){
-    std::cout << "OnMessage" << std::endl;
-    /// 从网络缓冲区读取远程 RPC 调用请求的字符流
-    std::string recv_buf = buffer->retrieveAllAsString();
-    // 使用 protobuf 的CodeInputStream 反序列化 RPC 请求
-    google::protobuf::io::ArrayInputStream raw_input(recv_buf.data(), recv_buf.size());
-    google::protobuf::io::CodedInputStream coded_input(&raw_input);
+    while(buffer->readableBytes() > 0) {
+        const char *data = buffer->peek();
+        Krpc::RpcHeader krpcHeader;
+        size_t args_offset = 0;
+        size_t frame_size = 0;
+        std::string err;
+        int ret = DecodeRequestFrame(data, buffer->readableBytes(), &krpcHeader, &args_offset, &frame_size, &err);
+        if(ret == 0) {
+            return;  // 请求帧还没收全，等待更多数据
+        }
+        if(ret < 0) {
+            KrpcLogger::Error(err + " from " + conn->peerAddress().toIpPort());
+            buffer->retrieveAll();
+            conn->forceClose();  // 数据流已经无法再正确分帧，断开连接
+            return;
+        }
 
-    /*
-     * Protobuf格式-> {RpcHeader:[header_size, (service_name, method_name, args_size)], args }
-     */
-    uint32_t header_size{};       // 头部长度
-    coded_input.ReadVarint32(&header_size); // 解析 header_size
-
-    // 根据 header_size 读取数据头的原始字符流，反序列化数据，得到RPC 请求的详细信息
-    std::string rpc_header_str;   // 头信息字符串(缓冲区)
-    Krpc::RpcHeader krpcHeader;   // krpc头部
-    std::string service_name;     // 服务对象名
-    std::string method_name;      // 方法名
-    uint32_t args_size{};         // 函数参数长度
-
-    // 设置读取限制
-    google::protobuf::io::CodedInputStream::Limit msg_limit = coded_input.PushLimit(header_size);
-    coded_input.ReadString(&rpc_header_str, header_size);
-    // 恢复之前的限制，以便安全的继续读取其他数据
-    coded_input.PopLimit(msg_limit);
-    // 读取头部信息 包含 服务名、方法名、参数长度
-    if (krpcHeader.ParseFromString(rpc_header_str)) {
-        service_name = krpcHeader.service_name();
-        method_name = krpcHeader.method_name();
-        args_size = krpcHeader.args_size();
-    } else {
-        KrpcLogger::Error("read args error");
-        return;
+        /// 直接在输入缓冲区上解析参数并处理请求，处理完再移除整个请求帧
+        if(krpcHeader.cancel()) {
+            HandleCancel(conn, krpcHeader.request_id());
+        } else if(krpcHeader.batch()) {
+            HandleBatch(conn, krpcHeader, data + args_offset, receive_time);
+        } else {
+            HandleRequest(conn, krpcHeader, data + args_offset, receive_time);
+        }
+        buffer->retrieve(frame_size);
+    }
+}
+
+/**
+ * @brief 解码一个请求帧的头部
+ * @details 头部长度和参数长度都来自对端，分别限制在 kMaxHeaderSize 和 kMaxArgsSize 以内，
+ *          超过时不等待数据收全，直接视为格式错误
+ */
+int KrpcProvider::DecodeRequestFrame(const char* data, size_t readable, Krpc::RpcHeader* header,
+                                     size_t* args_offset, size_t* frame_size, std::string* err){
+    /// 解析 varint32 编码的头部长度
+    google::protobuf::io::CodedInputStream coded_input(reinterpret_cast<const uint8_t*>(data), readable);
+    uint32_t header_size{};
+    if(!coded_input.ReadVarint32(&header_size)) {
+        // varint32 最多 5 个字节，不足 5 个字节时可能只是还没收全
+        if(readable < 5) {
+            return 0;
+        }
+        *err = "invalid rpc header size";
+        return -1;
+    }
+    if(header_size > kMaxHeaderSize) {
+        // 不等待这么长的头部收全，否则对端可以让这条连接无限制地缓存数据
+        *err = "rpc header too large";
+        return -1;
+    }
+    size_t header_offset = coded_input.CurrentPosition();
+    if(readable < header_offset + header_size) {
+        return 0;  // 头部还没收全
     }
 
-    // 读取 RPC 参数 ，直接读取 args_size 长度的字符串数据
-    std::string args_str;
-    bool read_args_success = coded_input.ReadString(&args_str, args_size);
-    if(!read_args_success) {
-        KrpcLogger::Error("read args error");
+    /// 解析头部，得到参数长度，从而得到整个请求帧的长度
+    if(!header->ParseFromArray(data + header_offset, header_size)
+       || header->args_size() > kMaxArgsSize) {
+        *err = "invalid rpc header";
+        return -1;
+    }
+    *args_offset = header_offset + header_size;
+    *frame_size = *args_offset + header->args_size();
+    if(readable < *frame_size) {
+        return 0;  // 参数还没收全
+    }
+    return 1;
+}
+
+/**
+ * @brief 把一个响应帧追加到连接的待发送缓冲区
+ * @details 先计算各部分的长度，再把整个响应帧直接序列化到待发送缓冲区中。
+ *          缓冲区中的第一个响应用 queueInLoop 安排发送：在 IO 事件中产生时，muduo 处理完本轮所有 IO 事件后才执行；
+ *          在 pending functor 中产生时，会在当前这批 pending functor 执行完之后执行。
+ *          期间同一连接上的其他响应都追加到同一个缓冲区，最后一起发出
+ */
+void KrpcProvider::SendResponseFrame(const muduo::net::TcpConnectionPtr& conn, Krpc::RpcResponseHeader* header,
+                                     const google::protobuf::Message* body){
+    // ByteSizeLong 会缓存计算结果供后面的序列化使用
+    size_t body_size = body != nullptr ? body->ByteSizeLong() : 0;
+    header->set_body_size(body_size);
+    size_t header_size = header->ByteSizeLong();
+    size_t frame_size = google::protobuf::io::CodedOutputStream::VarintSize32(static_cast<uint32_t>(header_size))
+                        + header_size + body_size;
+
+    ConnectionState *state = GetConnectionState(conn);
+    muduo::net::Buffer local;
+    muduo::net::Buffer *buf = state != nullptr ? &state->output : &local;
+    buf->ensureWritableBytes(frame_size);
+    uint8_t *target = reinterpret_cast<uint8_t*>(buf->beginWrite());
+    target = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(header_size), target);
+    target = header->SerializeWithCachedSizesToArray(target);
+    if(body != nullptr) {
+        body->SerializeWithCachedSizesToArray(target);
+    }
+    buf->hasWritten(frame_size);
+    if(state == nullptr) {
+        conn->send(buf);
         return;
     }
+    if(state->flush_pending) {
+        return;  // 已经安排了发送，会连同这个响应一起发出
+    }
+    // 处理输入时产生的响应 和 同一批 pending functor 中交回的业务线程完成，都由同一次 FlushOutput 发出
+    state->flush_pending = true;
+    conn->getLoop()->queueInLoop(std::bind(&KrpcProvider::FlushOutput, conn));
+}
+
+/**
+ * @brief 发送框架错误
+ */
+void KrpcProvider::SendErrorResponse(const muduo::net::TcpConnectionPtr& conn, uint64_t request_id,
+                                     int status, const std::string& error_text){
+    Krpc::RpcResponseHeader header;
+    header.set_request_id(request_id);
+    header.set_status(static_cast<Krpc::RpcStatus>(status));
+    header.set_error_text(error_text.substr(0, kMaxErrorTextSize));
+    SendResponseFrame(conn, &header, nullptr);
+}
 
-    /// 从 service_map 中获取 service 对象和 method 对象
-    auto it = service_map.find(service_name);
-    if(it == service_map.end()){
-        std::cout << service_name << " is not exits!" << std::endl;
+/**
+ * @brief 发送连接上攒下的所有响应帧
+ * @details 在 IO 线程中会直接写 socket，只有没写完的部分才会拷贝进连接的输出缓冲区
+ */
+void KrpcProvider::FlushOutput(const muduo::net::TcpConnectionPtr& conn){
+    ConnectionState *state = GetConnectionState(conn);
+    if(state == nullptr) {
         return;
     }
-    auto mit = it->second.method_map.find(method_name);
-    if(mit == it->second.method_map.end()) {
-        std::cout << service_name << "." << method_name << "is not exist!" << std::endl;
+    state->flush_pending = false;
+    if(state->output.readableBytes() > 0) {
+        // send 会取走缓冲区中的全部数据，缓冲区的内存留给下一轮使用
+        conn->send(&state->output);
+    }
+}
+
+/**
+ * @brief 处理一个完整的请求帧
+ * @details 根据请求头获取请求中的 service 对象和 method 对象，
+ *          参数直接从输入缓冲区中反序列化，不再拷贝出中间字符串
+ */
+void KrpcProvider::HandleRequest(const muduo::net::TcpConnectionPtr& conn,
+                                 const Krpc::RpcHeader& krpcHeader, const char* args,
+                                 muduo::Timestamp receive_time){
+    /*
+     * Protobuf格式-> {RpcHeader:[header_size, (args_size, request_id, timeout_ms, method_id)], args }
+     */
+    uint32_t args_size = krpcHeader.args_size();                  // 函数参数长度
+    uint64_t request_id = krpcHeader.request_id();                // 请求 id
+
+    /// 从分发表中获取 service 对象和 method 对象
+    const MethodEntry *entry = FindMethod(krpcHeader);
+    if(entry == nullptr) {
+        std::string error_text = "method " + krpcHeader.service_name() + "." + krpcHeader.method_name()
+                                 + " (id " + std::to_string(krpcHeader.method_id()) + ") is not exist!";
+        std::cout << error_text << std::endl;
+        SendErrorResponse(conn, request_id, Krpc::RPC_METHOD_NOT_FOUND, error_text);
         return;
     }
     // 获取服务对象和服务方法
-    google::protobuf::Service *service = it->second.service;
-    const google::protobuf::MethodDescriptor * method = mit->second;
+    google::protobuf::Service *service = entry->service;
+    const google::protobuf::MethodDescriptor * method = entry->method;
+
+    /// 客户端设置了超时时间时，从收到请求开始计算截止时间，已经过期的请求不再处理
+    muduo::Timestamp deadline = muduo::Timestamp::invalid();
+    if(krpcHeader.timeout_ms() > 0) {
+        deadline = muduo::addTime(receive_time, krpcHeader.timeout_ms() / 1000.0);
+        if(deadline < muduo::Timestamp::now()) {
+            KrpcLogger::Warning(method->full_name() + " request expired, dropped");
+            return;
+        }
+    }
 
     /// 生成 RPC 方法调用请求的request和响应的response参数
-    // 动态创建请求对象
-    google::protobuf::Message * request = service->GetRequestPrototype(method).New();
-    // 解析请求参数
-    if(!request->ParseFromString(args_str)) {
-        std::cout << service_name << "." << method_name << " parse error!" << std::endl;
+    // 请求和响应都在本次调用的 arena 上创建，响应发送后随 arena 一起释放
+    CallContext *ctx = NewCallContext();
+    ctx->conn = conn;
+    ctx->service = service;
+    ctx->method = method;
+    ctx->request_id = request_id;
+    ctx->deadline = deadline;
+    ctx->request = entry->request_prototype->New(&ctx->arena);
+    // 解析请求参数，ParseFromArray 只读取 [args, args + args_size) 范围内的数据
+    if(!ctx->request->ParseFromArray(args, args_size)) {
+        std::cout << method->full_name() << " parse error!" << std::endl;
+        ReleaseCallContext(ctx);
+        SendErrorResponse(conn, request_id, Krpc::RPC_BAD_REQUEST, method->full_name() + " parse request error!");
+        return;
+    }
+    ctx->response = entry->response_prototype->New(&ctx->arena);
+    /// 登记为正在处理的请求，客户端可以通过取消帧取消
+    ConnectionState *state = GetConnectionState(conn);
+    if(state != nullptr) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->inflight.emplace(request_id, ctx);
+    }
+    DispatchCall(ctx);
+}
+
+/**
+ * @brief 处理一个批量请求帧
+ * @details 每个调用与普通请求一样使用自己的调用上下文，可以在多个工作线程中并行执行；
+ *          所有调用都登记在批量请求的 request_id 下，取消帧 或 断开连接会取消其中的每个调用
+ */
+void KrpcProvider::HandleBatch(const muduo::net::TcpConnectionPtr& conn,
+                               const Krpc::RpcHeader& krpcHeader, const char* args,
+                               muduo::Timestamp receive_time){
+    uint64_t request_id = krpcHeader.request_id();
+    muduo::Timestamp deadline = muduo::Timestamp::invalid();
+    if(krpcHeader.timeout_ms() > 0) {
+        deadline = muduo::addTime(receive_time, krpcHeader.timeout_ms() / 1000.0);
+        if(deadline < muduo::Timestamp::now()) {
+            KrpcLogger::Warning("batch request expired, dropped");
+            return;
+        }
+    }
+    Krpc::RpcBatchRequest batch_request;
+    if(!batch_request.ParseFromArray(args, krpcHeader.args_size())) {
+        SendErrorResponse(conn, request_id, Krpc::RPC_BAD_REQUEST, "parse batch request error!");
+        return;
+    }
+
+    BatchCall *batch = new BatchCall();
+    batch->conn = conn;
+    batch->request_id = request_id;
+    batch->deadline = deadline;
+    batch->canceled = false;
+    ConnectionState *state = GetConnectionState(conn);
+    int count = batch_request.entries_size();
+    for(int i = 0; i < count; ++i) {
+        batch->response.add_results();
+    }
+    // 多计一个，在当前 IO 线程中执行的调用不会在派发完所有调用之前就发出响应
+    batch->remaining = count + 1;
+    for(int i = 0; i < count; ++i) {
+        const Krpc::RpcBatchEntry &batch_entry = batch_request.entries(i);
+        const MethodEntry *entry = FindMethod(batch_entry.method_id());
+        if(entry == nullptr) {
+            Krpc::RpcBatchResult *result = batch->response.mutable_results(i);
+            result->set_status(Krpc::RPC_METHOD_NOT_FOUND);
+            result->set_error_text("method id " + std::to_string(batch_entry.method_id()) + " is not exist!");
+            FinishBatchCall(batch);
+            continue;
+        }
+        CallContext *ctx = NewCallContext();
+        ctx->conn = conn;
+        ctx->service = entry->service;
+        ctx->method = entry->method;
+        ctx->request_id = request_id;
+        ctx->deadline = deadline;
+        ctx->batch = batch;
+        ctx->batch_index = i;
+        ctx->request = entry->request_prototype->New(&ctx->arena);
+        if(!ctx->request->ParseFromString(batch_entry.args())) {
+            Krpc::RpcBatchResult *result = batch->response.mutable_results(i);
+            result->set_status(Krpc::RPC_BAD_REQUEST);
+            result->set_error_text(entry->method->full_name() + " parse request error!");
+            ReleaseCallContext(ctx);
+            FinishBatchCall(batch);
+            continue;
+        }
+        ctx->response = entry->response_prototype->New(&ctx->arena);
+        // 派发前登记，调用可能在派发过程中就已经结束
+        if(state != nullptr) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->inflight.emplace(request_id, ctx);
+        }
+        DispatchCall(ctx);
+    }
+    FinishBatchCall(batch);
+}
+
+/**
+ * @brief 派发一个调用
+ * @details 请求参数已经在 IO 线程中解析完毕，服务方法交给业务线程池执行；
+ *          线程池队列已满时在当前 IO 线程中执行，相当于对客户端施加背压
+ */
+void KrpcProvider::DispatchCall(CallContext* ctx){
+    if(worker_pool) {
+        KrpcProvider *provider = this;
+        if(worker_pool->TrySubmit([provider, ctx]() { provider->InvokeMethod(ctx); }, AffinityHint())) {
+            return;
+        }
+    }
+    InvokeMethod(ctx);
+}
+
+/**
+ * @brief 按请求头查找要调用的方法
+ * @details 分发表在 Run 之前构建完成，之后只读，多个 IO 线程可以同时查找
+ */
+const KrpcProvider::MethodEntry* KrpcProvider::FindMethod(const Krpc::RpcHeader& krpcHeader) const{
+    uint32_t id = krpcHeader.method_id();
+    if(id == 0) {
+        // 不带方法 id 的请求，按服务名和方法名找到方法后再计算 id
+        auto it = service_map.find(krpcHeader.service_name());
+        if(it == service_map.end()) {
+            return nullptr;
+        }
+        auto mit = it->second.method_map.find(krpcHeader.method_name());
+        if(mit == it->second.method_map.end()) {
+            return nullptr;
+        }
+        id = KrpcMethodId::Of(mit->second);
+    }
+    return FindMethod(id);
+}
+
+/**
+ * @brief 按方法 id 在分发表中二分查找
+ */
+const KrpcProvider::MethodEntry* KrpcProvider::FindMethod(uint32_t id) const{
+    auto pos = std::lower_bound(method_table.begin(), method_table.end(), id,
+                                [](const MethodEntry &e, uint32_t key) { return e.id < key; });
+    if(pos == method_table.end() || pos->id != id) {
+        return nullptr;
+    }
+    return &*pos;
+}
+
+/**
+ * @brief 当前 IO 线程提交任务时的亲和性提示
+ * @details 第 i 个 IO 线程的第 k 组工作线程下标为 i + k * IO 线程数，各 IO 线程的分组互不重叠
+ */
+size_t KrpcProvider::AffinityHint(){
+    size_t io_index = t_ioIndex;
+    static thread_local size_t round = 0;
+    size_t io_num = io_thread_num > 0 ? io_thread_num : 1;
+    size_t groups = worker_pool->ThreadNum() / io_num;
+    if(groups <= 1) {
+        return io_index;
+    }
+    return io_index + io_num * (round++ % groups);
+}
+
+/**
+ * @brief 执行服务方法
+ */
+void KrpcProvider::InvokeMethod(CallContext* ctx){
+    // 排队期间已经过期或被取消的请求，直接结束调用，SendRpcResponse 中不会发送响应
+    if(ctx->controller.IsCanceled()
+       || (ctx->deadline.valid() && ctx->deadline < muduo::Timestamp::now())) {
+        ctx->Run();
         return;
     }
-    // 动态创建响应对象
-    google::protobuf::Message *response = service->GetResponsePrototype(method).New();
-    /// 绑定回调函数 用于在方法调用完成后发送响应
-    /// 相当于执行 void RpcProvider::SendRpcResponse(conn, response)
-    google::protobuf::Closure *done = google::protobuf::NewCallback<KrpcProvider,
-                                                        const muduo::net::TcpConnectionPtr &,
-                                                        google::protobuf::Message *>(this,
-                                                                                     &KrpcProvider::SendRpcResponse,
-                                                                                     conn, response);
+    /// 调用上下文本身就是 done 回调
+    /// done->Run() 相当于执行 void RpcProvider::SendRpcResponse(ctx)
     // 在框架上根据远端 RPC 请求，调用当前 RPC 节点上发布的方法
-    service->CallMethod(method, nullptr, request, response, done); // 调用服务方法
+    ctx->service->CallMethod(ctx->method, &ctx->controller, ctx->request, ctx->response, ctx); // 调用服务方法
+}
+
+/**
+ * @brief 处理取消帧
+ * @details 只标记控制器并通知服务方法，调用仍然由服务方法执行 done 结束，届时不再发送响应；
+ *          请求已经处理完成时忽略取消帧
+ */
+void KrpcProvider::HandleCancel(const muduo::net::TcpConnectionPtr& conn, uint64_t request_id){
+    ConnectionState *state = GetConnectionState(conn);
+    if(state == nullptr) {
+        return;
+    }
+    std::vector<google::protobuf::Closure*> callbacks;
+    {
+        // 持有锁时上下文不会被回收
+        std::lock_guard<std::mutex> lock(state->mutex);
+        auto range = state->inflight.equal_range(request_id);
+        for(auto it = range.first; it != range.second; ++it) {
+            google::protobuf::Closure *callback = it->second->controller.TakeCancelCallback(true);
+            if(callback != nullptr) {
+                callbacks.push_back(callback);
+            }
+        }
+    }
+    // 取消回调可能会执行 done，必须在锁外执行
+    for(google::protobuf::Closure *callback : callbacks) {
+        callback->Run();
+    }
+}
+
+/**
+ * @brief 调用已经完成，从连接的正在处理的请求中移除
+ */
+void KrpcProvider::RemoveInflight(CallContext* ctx){
+    ConnectionState *state = GetConnectionState(ctx->conn);
+    if(state == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(state->mutex);
+    auto range = state->inflight.equal_range(ctx->request_id);
+    for(auto it = range.first; it != range.second; ++it) {
+        if(it->second == ctx) {
+            state->inflight.erase(it);
+            return;
+        }
+    }
 }
 
 /**
  * @brief 发送 PRC 响应给客户端
- * @param conn 连接
- * @param response 服务端响应
+ * @details 响应格式 {header_size(varint32), RpcResponseHeader:(request_id, body_size), body}
+ *          先计算出整个响应帧的长度，按该长度申请一次缓冲区，再把头部和消息体直接序列化进去，
+ *          不再经过中间字符串
+ * @param ctx 调用上下文
  */
-void KrpcProvider::SendRpcResponse(const muduo::net::TcpConnectionPtr& conn, google::protobuf::Message* response){
-    std::string response_str;
-    // 如果序列化成功，通过网络把 PRC 方法执行的结果返回给客户端调用方
-    if(response->SerializeToString(&response_str)) {
-        conn->send(response_str);
-    } else {
+void KrpcProvider::SendRpcResponse(CallContext* ctx){
+    if(ctx->batch != nullptr) {
+        FinishBatchEntry(ctx);
+        return;
+    }
+    google::protobuf::Message *response = ctx->response;
+    /// 调用已经完成，不能再被取消
+    RemoveInflight(ctx);
+    // 未被取消时，NotifyOnCancel 注册的回调在调用完成后执行
+    google::protobuf::Closure *cancel_callback = ctx->controller.TakeCancelCallback(false);
+    if(cancel_callback != nullptr) {
+        cancel_callback->Run();
+    }
+    // 客户端已经取消 或 因超时放弃了这次调用，不再发送响应
+    if(ctx->controller.IsCanceled()
+       || (ctx->deadline.valid() && ctx->deadline < muduo::Timestamp::now())) {
+        ReleaseCallContext(ctx);
+        return;
+    }
+    // 响应头带回请求 id，客户端据此在同一连接上匹配乱序返回的响应
+    Krpc::RpcResponseHeader response_header;
+    response_header.set_request_id(ctx->request_id);
+    if(ctx->controller.Failed()) {
+        /// 服务方法通过 controller 报告了错误，只带回错误码和错误信息
+        response_header.set_status(static_cast<Krpc::RpcStatus>(ctx->controller.ErrorCode()));
+        response_header.set_error_text(ctx->controller.ErrorText().substr(0, kMaxErrorTextSize));
+        SendResponseFrame(ctx->conn, &response_header, nullptr);
+    } else if(!response->IsInitialized()) {
         std::cout << "Serialize Response error!" << std::endl;
+        response_header.set_status(Krpc::RPC_INTERNAL_ERROR);
+        response_header.set_error_text("serialize response error!");
+        SendResponseFrame(ctx->conn, &response_header, nullptr);
+    } else {
+        /// 将整个响应帧直接序列化到发送缓冲区中
+        SendResponseFrame(ctx->conn, &response_header, response);
     }
     // conn->shutdown(); // 模拟HTTP短链接，由RpcProvider主动断开连接
+    // 响应已发出，释放本次调用的 arena
+    ReleaseCallContext(ctx);
 }
+
+/**
+ * @brief 批量请求中的一个调用结束，把结果写入批量响应
+ */
+void KrpcProvider::FinishBatchEntry(CallContext* ctx){
+    RemoveInflight(ctx);
+    google::protobuf::Closure *cancel_callback = ctx->controller.TakeCancelCallback(false);
+    if(cancel_callback != nullptr) {
+        cancel_callback->Run();
+    }
+    BatchCall *batch = ctx->batch;
+    Krpc::RpcBatchResult *result = batch->response.mutable_results(ctx->batch_index);
+    if(ctx->controller.IsCanceled()) {
+        // 取消帧 和 断开连接都会取消批量请求中的所有调用，整个批量请求不再发送响应
+        batch->canceled = true;
+    } else if(ctx->controller.Failed()) {
+        result->set_status(static_cast<Krpc::RpcStatus>(ctx->controller.ErrorCode()));
+        result->set_error_text(ctx->controller.ErrorText().substr(0, kMaxErrorTextSize));
+    } else if(!ctx->response->IsInitialized()) {
+        result->set_status(Krpc::RPC_INTERNAL_ERROR);
+        result->set_error_text("serialize response error!");
+    } else if(!batch->deadline.valid() || muduo::Timestamp::now() < batch->deadline) {
+        // 已经过期的批量请求不会发送响应，不必再序列化
+        ctx->response->SerializeToString(result->mutable_body());
+    }
+    ReleaseCallContext(ctx);
+    FinishBatchCall(batch);
+}
+
+/**
+ * @brief 批量请求中的调用数减一
+ */
+void KrpcProvider::FinishBatchCall(BatchCall* batch){
+    if(--batch->remaining > 0) {
+        return;
+    }
+    // 客户端已经取消 或 因超时放弃了这次调用时，不再发送响应
+    if(!batch->canceled && (!batch->deadline.valid() || muduo::Timestamp::now() < batch->deadline)) {
+        Krpc::RpcResponseHeader response_header;
+        response_header.set_request_id(batch->request_id);
+        SendResponseFrame(batch->conn, &response_header, &batch->response);
+    }
+    delete batch;
+}
+
+/**
+ * @brief 生成 Arena 参数，使用调用上下文自带的内存块作为 arena 的第一个内存块
+ */
+static google::protobuf::ArenaOptions MakeArenaOptions(char *block, size_t size) {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = size;
+    return options;
+}
+
+/**
+ * @brief 调用上下文构造函数
+ */
+KrpcProvider::CallContext::CallContext()
+        : provider(nullptr), service(nullptr), method(nullptr), request_id(0), batch(nullptr), batch_index(0),
+          deadline(muduo::Timestamp::invalid()), request(nullptr), response(nullptr),
+          arena(MakeArenaOptions(initial_block, sizeof(initial_block))) {
+}
+
+/**
+ * @brief done 回调 服务方法执行完毕后发送响应
+ */
+void KrpcProvider::CallContext::Run() {
+    // 服务方法在业务线程 或 其他线程中执行 done 时，把发送响应交回连接所在的 IO 线程：
+    // 响应直接序列化进连接的发送缓冲区，上下文也回到分配它的 IO 线程的缓存中
+    muduo::net::EventLoop *loop = conn->getLoop();
+    if(loop->isInLoopThread()) {
+        provider->SendRpcResponse(this);
+    } else {
+        loop->runInLoop(std::bind(&KrpcProvider::SendRpcResponse, provider, this));
+    }
+}
+
+/**
+ * @brief 线程退出时释放缓存的调用上下文
+ */
+KrpcProvider::CallContextCache::~CallContextCache() {
+    for(CallContext *ctx : contexts) {
+        delete ctx;
+    }
+}
+
+/**
+ * @brief 当前线程的调用上下文缓存
+ * @details 每个 IO 线程各自缓存，取用和回收都不需要加锁
+ */
+KrpcProvider::CallContextCache& KrpcProvider::LocalContextCache() {
+    static thread_local CallContextCache cache;
+    return cache;
+}
+
+/**
+ * @brief 获取一个调用上下文，优先复用当前线程缓存的上下文
+ */
+KrpcProvider::CallContext* KrpcProvider::NewCallContext() {
+    std::vector<CallContext*> &contexts = LocalContextCache().contexts;
+    CallContext *ctx = nullptr;
+    if(!contexts.empty()) {
+        ctx = contexts.back();
+        contexts.pop_back();
+    } else {
+        ctx = new CallContext();
+    }
+    ctx->provider = this;
+    return ctx;
+}
+
+/**
+ * @brief 回收调用上下文
+ * @details Reset 会析构 arena 上的 request/response 并释放额外申请的内存块，只保留初始内存块
+ */
+void KrpcProvider::ReleaseCallContext(CallContext* ctx) {
+    ctx->conn.reset();
+    ctx->batch = nullptr;
+    ctx->controller.Reset();
+    ctx->request = nullptr;
+    ctx->response = nullptr;
+    ctx->arena.Reset();
+    std::vector<CallContext*> &contexts = LocalContextCache().contexts;
+    if(contexts.size() < arena_cache_size) {
+        contexts.push_back(ctx);
+    } else {
+        delete ctx;
+    }
+}
+
 /**
  * @brief 析构函数 退出事件循环
  */
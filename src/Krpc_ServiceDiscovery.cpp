@@ -0,0 +1,215 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ServiceDiscovery.cpp
+  * @author         : 18483
+  * @brief          : 客户端服务发现缓存实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_ServiceDiscovery.h"
+#include "Krpc_Logger.h"
+#include <cstdlib>
+
+/**
+ * @brief 获取全局唯一的服务发现对象
+ */
+KrpcServiceDiscovery &KrpcServiceDiscovery::GetInstance() {
+    static KrpcServiceDiscovery discovery;
+    return discovery;
+}
+
+/**
+ * @brief 构造函数 ZooKeeper 会话和刷新线程在第一次查询时才建立
+ */
+KrpcServiceDiscovery::KrpcServiceDiscovery() : m_expired(false), m_stop(false) {
+}
+
+/**
+ * @brief 析构函数 停止后台刷新线程
+ */
+KrpcServiceDiscovery::~KrpcServiceDiscovery() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_refreshCond.notify_all();
+    if(m_refresher.joinable()) {
+        m_refresher.join();
+    }
+}
+
+/**
+ * @brief 查询提供服务的全部服务端实例
+ * @details 先查内存缓存，未命中时再查询 ZooKeeper 并放入缓存
+ */
+KrpcInstanceList KrpcServiceDiscovery::GetInstances(const std::string &service_name) {
+    // 构造 ZooKeeper 路径
+    std::string service_path = "/" + service_name;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_cache.find(service_path);
+        if(it != m_cache.end()) {
+            return it->second;
+        }
+    }
+    return Load(service_path);
+}
+
+/**
+ * @brief 缓存未命中时加载实例列表
+ * @details 缓存在 m_zkMutex 内写入，与后台刷新串行，后完成的查询总是覆盖先完成的
+ */
+KrpcInstanceList KrpcServiceDiscovery::Load(const std::string &path) {
+    std::lock_guard<std::mutex> zk_lock(m_zkMutex);
+    {
+        // 等待 m_zkMutex 期间其他调用方可能已经加载过
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_cache.find(path);
+        if(it != m_cache.end()) {
+            return it->second;
+        }
+    }
+    KrpcInstanceList instances = Query(path);
+    if(instances) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cache[path] = instances;
+    }
+    return instances;
+}
+
+/**
+ * @brief 从 ZooKeeper 查询实例列表并注册 watcher
+ * @details 只在服务节点上注册子节点 watcher：实例节点是临时节点，创建后数据不会再变化，
+ *          实例上线、下线都会体现为子节点的增删
+ */
+KrpcInstanceList KrpcServiceDiscovery::Query(const std::string &path) {
+    bool expired = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        expired = m_expired;
+        m_expired = false;
+    }
+    // 第一次查询 或 会话已过期时，建立新的 ZooKeeper 会话
+    if(!m_zkclient || expired) {
+        m_zkclient.reset(new ZkClient());
+        m_zkclient->Start();
+        if(!m_refresher.joinable()) {
+            m_refresher = std::thread(&KrpcServiceDiscovery::RefreshLoop, this);
+        }
+    }
+
+    bool ok = false;
+    std::vector<std::string> children = m_zkclient->GetChildren(path.c_str(), &KrpcServiceDiscovery::Watcher, this, &ok);
+    if(!ok) {
+        LOG(ERROR) << path + " is not exist!";
+        return nullptr;
+    }
+    std::shared_ptr<std::vector<KrpcServiceInstance>> instances = std::make_shared<std::vector<KrpcServiceInstance>>();
+    for(const std::string &child : children) {
+        // 实例节点在列出之后、读取之前可能已经下线，读取失败时跳过即可
+        std::string data = m_zkclient->GetData((path + "/" + child).c_str(), nullptr, nullptr);
+        KrpcServiceInstance instance;
+        if(data.empty() || !ParseInstance(data, &instance)) {
+            continue;
+        }
+        instances->push_back(instance);
+    }
+    if(instances->empty()) {
+        LOG(ERROR) << path + " has no available instance!";
+        return nullptr;
+    }
+    return instances;
+}
+
+/**
+ * @brief 解析实例节点数据 "ip:port:weight"
+ */
+bool KrpcServiceDiscovery::ParseInstance(const std::string &data, KrpcServiceInstance *instance) {
+    size_t idx = data.find(':');  // IP 和 端口分隔符
+    if(idx == std::string::npos) {
+        LOG(ERROR) << "instance address is invalid: " << data;
+        return false;
+    }
+    instance->ip = data.substr(0, idx);
+    instance->port = static_cast<uint16_t>(atoi(data.substr(idx + 1).c_str()));
+    instance->weight = 1;
+    size_t widx = data.find(':', idx + 1);  // 端口 和 权重分隔符
+    if(widx != std::string::npos) {
+        int weight = atoi(data.substr(widx + 1).c_str());
+        instance->weight = weight > 0 ? weight : 1;
+    }
+    return true;
+}
+
+/**
+ * @brief 节点 watcher
+ */
+void KrpcServiceDiscovery::Watcher(zhandle_t *zh, int type, int state, const char *path, void *watcherCtx) {
+    KrpcServiceDiscovery *self = static_cast<KrpcServiceDiscovery*>(watcherCtx);
+    if(type == ZOO_SESSION_EVENT) {
+        // 会话过期后所有 watcher 都已失效，缓存不再可信
+        if(state == ZOO_EXPIRED_SESSION_STATE) {
+            self->ScheduleRefreshAll();
+        }
+        return;
+    }
+    // 实例上线、下线 或 服务节点被删除
+    if(path != nullptr) {
+        self->ScheduleRefresh(path);
+    }
+}
+
+/**
+ * @brief 安排后台刷新 path 对应的实例列表
+ */
+void KrpcServiceDiscovery::ScheduleRefresh(const std::string &path) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_refreshPaths.insert(path);
+    }
+    m_refreshCond.notify_one();
+}
+
+/**
+ * @brief 会话过期，安排重建会话并刷新全部缓存
+ */
+void KrpcServiceDiscovery::ScheduleRefreshAll() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_expired = true;
+        for(const auto &entry : m_cache) {
+            m_refreshPaths.insert(entry.first);
+        }
+    }
+    m_refreshCond.notify_one();
+}
+
+/**
+ * @brief 后台刷新线程
+ * @details 刷新完成前缓存中仍是旧列表；服务节点已删除 或 查询失败时移除缓存，下次查询时重新加载
+ */
+void KrpcServiceDiscovery::RefreshLoop() {
+    while(true) {
+        std::unordered_set<std::string> paths;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_refreshCond.wait(lock, [this] { return m_stop || !m_refreshPaths.empty(); });
+            if(m_stop) {
+                return;
+            }
+            paths.swap(m_refreshPaths);
+        }
+        for(const std::string &path : paths) {
+            std::lock_guard<std::mutex> zk_lock(m_zkMutex);
+            KrpcInstanceList instances = Query(path);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(instances) {
+                m_cache[path] = instances;
+            } else {
+                m_cache.erase(path);
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ThreadPool.cpp
+  * @author         : 18483
+  * @brief          : 服务端业务线程池实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_ThreadPool.h"
+
+/**
+ * @brief 构造函数 启动工作线程
+ */
+KrpcThreadPool::KrpcThreadPool(int thread_num, size_t max_queue_size, const ThreadInitCallback &init_callback)
+        : m_maxQueueSize(max_queue_size), m_stopping(false), m_initCallback(init_callback) {
+    for(int i = 0; i < thread_num; ++i) {
+        m_threads.emplace_back(&KrpcThreadPool::WorkerLoop, this, static_cast<size_t>(i));
+    }
+}
+
+/**
+ * @brief 析构函数 执行完队列中剩余的任务后退出所有工作线程
+ */
+KrpcThreadPool::~KrpcThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_cv.notify_all();
+    for(auto &t : m_threads) {
+        t.join();
+    }
+}
+
+/**
+ * @brief 提交任务
+ */
+bool KrpcThreadPool::TrySubmit(const Task &task, size_t hint) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_stopping || m_queue.size() >= m_maxQueueSize) {
+            return false;
+        }
+        m_queue.push_back(task);
+    }
+    m_cv.notify_one();
+    return true;
+}
+
+/**
+ * @brief 工作线程 循环取出任务执行
+ */
+void KrpcThreadPool::WorkerLoop(size_t index) {
+    if(m_initCallback) {
+        m_initCallback(index);
+    }
+    while(true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+            if(m_queue.empty()) {
+                return;  // 正在退出且没有剩余任务
+            }
+            task.swap(m_queue.front());
+            m_queue.pop_front();
+        }
+        task();
+    }
+}
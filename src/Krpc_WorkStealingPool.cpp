@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_WorkStealingPool.cpp
+  * @author         : 18483
+  * @brief          : 工作窃取线程池实现
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+#include "Krpc_WorkStealingPool.h"
+
+/// 当前线程所属的线程池和在其中的下标，用于识别工作线程自己提交的任务
+static thread_local KrpcWorkStealingPool *t_pool = nullptr;
+static thread_local size_t t_index = 0;
+
+/**
+ * @brief 构造函数 启动工作线程
+ */
+KrpcWorkStealingPool::KrpcWorkStealingPool(int thread_num, size_t max_pending, const ThreadInitCallback &init_callback)
+        : m_initCallback(init_callback), m_pending(0), m_maxPending(max_pending), m_sleeping(0), m_stopping(false) {
+    if(thread_num <= 0) {
+        thread_num = 1;
+    }
+    // 先创建好所有队列，工作线程启动后就可能互相窃取
+    for(int i = 0; i < thread_num; ++i) {
+        m_workers.emplace_back(new Worker());
+    }
+    for(int i = 0; i < thread_num; ++i) {
+        m_threads.emplace_back(&KrpcWorkStealingPool::WorkerLoop, this, static_cast<size_t>(i));
+    }
+}
+
+/**
+ * @brief 析构函数 执行完所有剩余的任务后退出工作线程
+ */
+KrpcWorkStealingPool::~KrpcWorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_parkMutex);
+        m_stopping = true;
+    }
+    m_parkCv.notify_all();
+    for(auto &t : m_threads) {
+        t.join();
+    }
+}
+
+/**
+ * @brief 提交任务
+ */
+bool KrpcWorkStealingPool::TrySubmit(const Task &task, size_t hint) {
+    if(m_stopping) {
+        return false;
+    }
+    // 只有真正计数过的提交才需要撤销计数，否则 m_pending 会下溢，析构时工作线程永远等不到 0
+    if(m_pending.fetch_add(1) >= m_maxPending) {
+        --m_pending;
+        return false;
+    }
+    size_t index = (t_pool == this) ? t_index : hint % m_workers.size();
+    {
+        Worker &worker = *m_workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(task);
+    }
+    // m_pending 先于 m_sleeping 修改和读取，与 WorkerLoop 中的顺序相反，保证不会漏掉唤醒
+    if(m_sleeping > 0) {
+        std::lock_guard<std::mutex> lock(m_parkMutex);
+        m_parkCv.notify_one();
+    }
+    return true;
+}
+
+/**
+ * @brief 工作线程 循环取任务执行
+ */
+void KrpcWorkStealingPool::WorkerLoop(size_t index) {
+    t_pool = this;
+    t_index = index;
+    if(m_initCallback) {
+        m_initCallback(index);
+    }
+    while(true) {
+        Task task;
+        if(PopLocal(index, &task) || Steal(index, &task)) {
+            --m_pending;
+            task();
+            continue;
+        }
+        /// 所有队列都为空，休眠等待新任务
+        std::unique_lock<std::mutex> lock(m_parkMutex);
+        ++m_sleeping;
+        m_parkCv.wait(lock, [this] { return m_stopping || m_pending > 0; });
+        --m_sleeping;
+        if(m_stopping && m_pending == 0) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 从自己队列的尾部取任务
+ */
+bool KrpcWorkStealingPool::PopLocal(size_t index, Task *task) {
+    Worker &worker = *m_workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if(worker.tasks.empty()) {
+        return false;
+    }
+    task->swap(worker.tasks.back());
+    worker.tasks.pop_back();
+    return true;
+}
+
+/**
+ * @brief 从其他工作线程队列的头部窃取任务
+ */
+bool KrpcWorkStealingPool::Steal(size_t index, Task *task) {
+    size_t n = m_workers.size();
+    for(size_t i = 1; i < n; ++i) {
+        Worker &victim = *m_workers[(index + i) % n];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if(victim.tasks.empty()) {
+            continue;
+        }
+        task->swap(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
@@ -14,226 +14,503 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-namespace Krpc {
-class RpcHeaderDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RpcHeader> _instance;
-} _RpcHeader_default_instance_;
-}  // namespace Krpc
-static void InitDefaultsscc_info_RpcHeader_Krpcheader_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::Krpc::_RpcHeader_default_instance_;
-    new (ptr) ::Krpc::RpcHeader();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Krpc::RpcHeader::InitAsDefaultInstance();
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RpcHeader_Krpcheader_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RpcHeader_Krpcheader_2eproto}, {}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_Krpcheader_2eproto[1];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_Krpcheader_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_Krpcheader_2eproto = nullptr;
+namespace Krpc {
+PROTOBUF_CONSTEXPR RpcHeader::RpcHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.method_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.args_size_)*/0u
+  , /*decltype(_impl_.timeout_ms_)*/0u
+  , /*decltype(_impl_.method_id_)*/0u
+  , /*decltype(_impl_.cancel_)*/false
+  , /*decltype(_impl_.batch_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcHeaderDefaultTypeInternal() {}
+  union {
+    RpcHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcHeaderDefaultTypeInternal _RpcHeader_default_instance_;
+PROTOBUF_CONSTEXPR RpcBatchEntry::RpcBatchEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.args_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.method_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcBatchEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcBatchEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcBatchEntryDefaultTypeInternal() {}
+  union {
+    RpcBatchEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcBatchEntryDefaultTypeInternal _RpcBatchEntry_default_instance_;
+PROTOBUF_CONSTEXPR RpcBatchRequest::RpcBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcBatchRequestDefaultTypeInternal() {}
+  union {
+    RpcBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcBatchRequestDefaultTypeInternal _RpcBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR RpcResponseHeader::RpcResponseHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.body_size_)*/0u
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcResponseHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcResponseHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcResponseHeaderDefaultTypeInternal() {}
+  union {
+    RpcResponseHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcResponseHeaderDefaultTypeInternal _RpcResponseHeader_default_instance_;
+PROTOBUF_CONSTEXPR RpcBatchResult::RpcBatchResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcBatchResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcBatchResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcBatchResultDefaultTypeInternal() {}
+  union {
+    RpcBatchResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcBatchResultDefaultTypeInternal _RpcBatchResult_default_instance_;
+PROTOBUF_CONSTEXPR RpcBatchResponse::RpcBatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcBatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcBatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcBatchResponseDefaultTypeInternal() {}
+  union {
+    RpcBatchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcBatchResponseDefaultTypeInternal _RpcBatchResponse_default_instance_;
+}  // namespace Krpc
+static ::_pb::Metadata file_level_metadata_Krpcheader_2eproto[6];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_Krpcheader_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Krpcheader_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_Krpcheader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_Krpcheader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, service_name_),
-  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, method_name_),
-  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, args_size_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, _impl_.method_name_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, _impl_.args_size_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, _impl_.timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, _impl_.cancel_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, _impl_.method_id_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcHeader, _impl_.batch_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchEntry, _impl_.method_id_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchEntry, _impl_.args_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchRequest, _impl_.entries_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcResponseHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcResponseHeader, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcResponseHeader, _impl_.body_size_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcResponseHeader, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcResponseHeader, _impl_.error_text_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchResult, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchResult, _impl_.error_text_),
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchResult, _impl_.body_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Krpc::RpcBatchResponse, _impl_.results_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::Krpc::RpcHeader)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Krpc::RpcHeader)},
+  { 14, -1, -1, sizeof(::Krpc::RpcBatchEntry)},
+  { 22, -1, -1, sizeof(::Krpc::RpcBatchRequest)},
+  { 29, -1, -1, sizeof(::Krpc::RpcResponseHeader)},
+  { 39, -1, -1, sizeof(::Krpc::RpcBatchResult)},
+  { 48, -1, -1, sizeof(::Krpc::RpcBatchResponse)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Krpc::_RpcHeader_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Krpc::_RpcHeader_default_instance_._instance,
+  &::Krpc::_RpcBatchEntry_default_instance_._instance,
+  &::Krpc::_RpcBatchRequest_default_instance_._instance,
+  &::Krpc::_RpcResponseHeader_default_instance_._instance,
+  &::Krpc::_RpcBatchResult_default_instance_._instance,
+  &::Krpc::_RpcBatchResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_Krpcheader_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\020Krpcheader.proto\022\004Krpc\"I\n\tRpcHeader\022\024\n"
-  "\014service_name\030\001 \001(\014\022\023\n\013method_name\030\002 \001(\014"
-  "\022\021\n\targs_size\030\003 \001(\rb\006proto3"
+  "\n\020Krpcheader.proto\022\004Krpc\"\243\001\n\tRpcHeader\022\024"
+  "\n\014service_name\030\001 \001(\014\022\023\n\013method_name\030\002 \001("
+  "\014\022\021\n\targs_size\030\003 \001(\r\022\022\n\nrequest_id\030\004 \001(\004"
+  "\022\022\n\ntimeout_ms\030\005 \001(\r\022\016\n\006cancel\030\006 \001(\010\022\021\n\t"
+  "method_id\030\007 \001(\007\022\r\n\005batch\030\010 \001(\010\"0\n\rRpcBat"
+  "chEntry\022\021\n\tmethod_id\030\001 \001(\007\022\014\n\004args\030\002 \001(\014"
+  "\"7\n\017RpcBatchRequest\022$\n\007entries\030\001 \003(\0132\023.K"
+  "rpc.RpcBatchEntry\"o\n\021RpcResponseHeader\022\022"
+  "\n\nrequest_id\030\001 \001(\004\022\021\n\tbody_size\030\002 \001(\r\022\037\n"
+  "\006status\030\003 \001(\0162\017.Krpc.RpcStatus\022\022\n\nerror_"
+  "text\030\004 \001(\014\"S\n\016RpcBatchResult\022\037\n\006status\030\001"
+  " \001(\0162\017.Krpc.RpcStatus\022\022\n\nerror_text\030\002 \001("
+  "\014\022\014\n\004body\030\003 \001(\014\"9\n\020RpcBatchResponse\022%\n\007r"
+  "esults\030\001 \003(\0132\024.Krpc.RpcBatchResult*\342\001\n\tR"
+  "pcStatus\022\n\n\006RPC_OK\020\000\022\025\n\021RPC_SERVICE_ERRO"
+  "R\020\001\022\030\n\024RPC_METHOD_NOT_FOUND\020\002\022\023\n\017RPC_BAD"
+  "_REQUEST\020\003\022\026\n\022RPC_INTERNAL_ERROR\020\004\022\017\n\013RP"
+  "C_TIMEOUT\020\005\022\020\n\014RPC_CANCELED\020\006\022\025\n\021RPC_NET"
+  "WORK_ERROR\020\007\022\033\n\027RPC_SERVICE_UNAVAILABLE\020"
+  "\010\022\024\n\020RPC_BAD_RESPONSE\020\tb\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_Krpcheader_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_Krpcheader_2eproto_sccs[1] = {
-  &scc_info_RpcHeader_Krpcheader_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_Krpcheader_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Krpcheader_2eproto = {
-  false, false, descriptor_table_protodef_Krpcheader_2eproto, "Krpcheader.proto", 107,
-  &descriptor_table_Krpcheader_2eproto_once, descriptor_table_Krpcheader_2eproto_sccs, descriptor_table_Krpcheader_2eproto_deps, 1, 0,
-  schemas, file_default_instances, TableStruct_Krpcheader_2eproto::offsets,
-  file_level_metadata_Krpcheader_2eproto, 1, file_level_enum_descriptors_Krpcheader_2eproto, file_level_service_descriptors_Krpcheader_2eproto,
+static ::_pbi::once_flag descriptor_table_Krpcheader_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Krpcheader_2eproto = {
+    false, false, 791, descriptor_table_protodef_Krpcheader_2eproto,
+    "Krpcheader.proto",
+    &descriptor_table_Krpcheader_2eproto_once, nullptr, 0, 6,
+    schemas, file_default_instances, TableStruct_Krpcheader_2eproto::offsets,
+    file_level_metadata_Krpcheader_2eproto, file_level_enum_descriptors_Krpcheader_2eproto,
+    file_level_service_descriptors_Krpcheader_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Krpcheader_2eproto_getter() {
+  return &descriptor_table_Krpcheader_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_Krpcheader_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_Krpcheader_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Krpcheader_2eproto(&descriptor_table_Krpcheader_2eproto);
 namespace Krpc {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RpcStatus_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_Krpcheader_2eproto);
+  return file_level_enum_descriptors_Krpcheader_2eproto[0];
+}
+bool RpcStatus_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
-void RpcHeader::InitAsDefaultInstance() {
-}
 class RpcHeader::_Internal {
  public:
 };
 
-RpcHeader::RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+RpcHeader::RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:Krpc.RpcHeader)
 }
 RpcHeader::RpcHeader(const RpcHeader& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.args_size_){}
+    , decltype(_impl_.timeout_ms_){}
+    , decltype(_impl_.method_id_){}
+    , decltype(_impl_.cancel_){}
+    , decltype(_impl_.batch_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  service_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_service_name().empty()) {
-    service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_service_name(),
-      GetArena());
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
   }
-  method_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_method_name().empty()) {
-    method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_method_name(),
-      GetArena());
+    _this->_impl_.method_name_.Set(from._internal_method_name(), 
+      _this->GetArenaForAllocation());
   }
-  args_size_ = from.args_size_;
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.batch_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.batch_));
   // @@protoc_insertion_point(copy_constructor:Krpc.RpcHeader)
 }
 
-void RpcHeader::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RpcHeader_Krpcheader_2eproto.base);
-  service_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  method_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  args_size_ = 0u;
+inline void RpcHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.args_size_){0u}
+    , decltype(_impl_.timeout_ms_){0u}
+    , decltype(_impl_.method_id_){0u}
+    , decltype(_impl_.cancel_){false}
+    , decltype(_impl_.batch_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RpcHeader::~RpcHeader() {
   // @@protoc_insertion_point(destructor:Krpc.RpcHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RpcHeader::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  service_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  method_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void RpcHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.Destroy();
+  _impl_.method_name_.Destroy();
 }
 
-void RpcHeader::ArenaDtor(void* object) {
-  RpcHeader* _this = reinterpret_cast< RpcHeader* >(object);
-  (void)_this;
-}
-void RpcHeader::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void RpcHeader::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RpcHeader& RpcHeader::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RpcHeader_Krpcheader_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RpcHeader::Clear() {
 // @@protoc_insertion_point(message_clear_start:Krpc.RpcHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  service_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  method_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  args_size_ = 0u;
+  _impl_.service_name_.ClearToEmpty();
+  _impl_.method_name_.ClearToEmpty();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.batch_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.batch_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RpcHeader::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RpcHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes service_name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_service_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes method_name = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_method_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 args_size = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          args_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.args_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 timeout_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool cancel = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.cancel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
+        continue;
+      // fixed32 method_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _impl_.method_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // bool batch = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.batch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RpcHeader::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* RpcHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Krpc.RpcHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes service_name = 1;
-  if (this->service_name().size() > 0) {
+  if (!this->_internal_service_name().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_service_name(), target);
   }
 
   // bytes method_name = 2;
-  if (this->method_name().size() > 0) {
+  if (!this->_internal_method_name().empty()) {
     target = stream->WriteBytesMaybeAliased(
         2, this->_internal_method_name(), target);
   }
 
   // uint32 args_size = 3;
-  if (this->args_size() != 0) {
+  if (this->_internal_args_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_args_size(), target);
+  }
+
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_request_id(), target);
+  }
+
+  // uint32 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_timeout_ms(), target);
+  }
+
+  // bool cancel = 6;
+  if (this->_internal_cancel() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_args_size(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_cancel(), target);
+  }
+
+  // fixed32 method_id = 7;
+  if (this->_internal_method_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(7, this->_internal_method_id(), target);
+  }
+
+  // bool batch = 8;
+  if (this->_internal_batch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_batch(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Krpc.RpcHeader)
@@ -244,78 +521,97 @@ size_t RpcHeader::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Krpc.RpcHeader)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes service_name = 1;
-  if (this->service_name().size() > 0) {
+  if (!this->_internal_service_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_service_name());
   }
 
   // bytes method_name = 2;
-  if (this->method_name().size() > 0) {
+  if (!this->_internal_method_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_method_name());
   }
 
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
   // uint32 args_size = 3;
-  if (this->args_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_args_size());
+  if (this->_internal_args_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_args_size());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timeout_ms());
+  }
+
+  // fixed32 method_id = 7;
+  if (this->_internal_method_id() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // bool cancel = 6;
+  if (this->_internal_cancel() != 0) {
+    total_size += 1 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void RpcHeader::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Krpc.RpcHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RpcHeader* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RpcHeader>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Krpc.RpcHeader)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Krpc.RpcHeader)
-    MergeFrom(*source);
+  // bool batch = 8;
+  if (this->_internal_batch() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RpcHeader::MergeFrom(const RpcHeader& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Krpc.RpcHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcHeader::GetClassData() const { return &_class_data_; }
+
+
+void RpcHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcHeader*>(&to_msg);
+  auto& from = static_cast<const RpcHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Krpc.RpcHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.service_name().size() > 0) {
-    _internal_set_service_name(from._internal_service_name());
+  if (!from._internal_service_name().empty()) {
+    _this->_internal_set_service_name(from._internal_service_name());
   }
-  if (from.method_name().size() > 0) {
-    _internal_set_method_name(from._internal_method_name());
+  if (!from._internal_method_name().empty()) {
+    _this->_internal_set_method_name(from._internal_method_name());
   }
-  if (from.args_size() != 0) {
-    _internal_set_args_size(from._internal_args_size());
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
   }
-}
-
-void RpcHeader::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Krpc.RpcHeader)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_args_size() != 0) {
+    _this->_internal_set_args_size(from._internal_args_size());
+  }
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
+  }
+  if (from._internal_method_id() != 0) {
+    _this->_internal_set_method_id(from._internal_method_id());
+  }
+  if (from._internal_cancel() != 0) {
+    _this->_internal_set_cancel(from._internal_cancel());
+  }
+  if (from._internal_batch() != 0) {
+    _this->_internal_set_batch(from._internal_batch());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RpcHeader::CopyFrom(const RpcHeader& from) {
@@ -331,22 +627,1210 @@ bool RpcHeader::IsInitialized() const {
 
 void RpcHeader::InternalSwap(RpcHeader* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  service_name_.Swap(&other->service_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  method_name_.Swap(&other->method_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(args_size_, other->args_size_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.method_name_, lhs_arena,
+      &other->_impl_.method_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcHeader, _impl_.batch_)
+      + sizeof(RpcHeader::_impl_.batch_)
+      - PROTOBUF_FIELD_OFFSET(RpcHeader, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RpcHeader::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Krpcheader_2eproto_getter, &descriptor_table_Krpcheader_2eproto_once,
+      file_level_metadata_Krpcheader_2eproto[0]);
 }
 
+// ===================================================================
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace Krpc
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::Krpc::RpcHeader* Arena::CreateMaybeMessage< ::Krpc::RpcHeader >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::Krpc::RpcHeader >(arena);
+class RpcBatchEntry::_Internal {
+ public:
+};
+
+RpcBatchEntry::RpcBatchEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Krpc.RpcBatchEntry)
+}
+RpcBatchEntry::RpcBatchEntry(const RpcBatchEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcBatchEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.args_){}
+    , decltype(_impl_.method_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.args_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.args_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_args().empty()) {
+    _this->_impl_.args_.Set(from._internal_args(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.method_id_ = from._impl_.method_id_;
+  // @@protoc_insertion_point(copy_constructor:Krpc.RpcBatchEntry)
+}
+
+inline void RpcBatchEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.args_){}
+    , decltype(_impl_.method_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.args_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.args_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RpcBatchEntry::~RpcBatchEntry() {
+  // @@protoc_insertion_point(destructor:Krpc.RpcBatchEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RpcBatchEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.args_.Destroy();
+}
+
+void RpcBatchEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RpcBatchEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:Krpc.RpcBatchEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.args_.ClearToEmpty();
+  _impl_.method_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcBatchEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // fixed32 method_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.method_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes args = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_args();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RpcBatchEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Krpc.RpcBatchEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // fixed32 method_id = 1;
+  if (this->_internal_method_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_method_id(), target);
+  }
+
+  // bytes args = 2;
+  if (!this->_internal_args().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_args(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Krpc.RpcBatchEntry)
+  return target;
+}
+
+size_t RpcBatchEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Krpc.RpcBatchEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes args = 2;
+  if (!this->_internal_args().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_args());
+  }
+
+  // fixed32 method_id = 1;
+  if (this->_internal_method_id() != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcBatchEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcBatchEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcBatchEntry::GetClassData() const { return &_class_data_; }
+
+
+void RpcBatchEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcBatchEntry*>(&to_msg);
+  auto& from = static_cast<const RpcBatchEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Krpc.RpcBatchEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_args().empty()) {
+    _this->_internal_set_args(from._internal_args());
+  }
+  if (from._internal_method_id() != 0) {
+    _this->_internal_set_method_id(from._internal_method_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RpcBatchEntry::CopyFrom(const RpcBatchEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Krpc.RpcBatchEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RpcBatchEntry::IsInitialized() const {
+  return true;
+}
+
+void RpcBatchEntry::InternalSwap(RpcBatchEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.args_, lhs_arena,
+      &other->_impl_.args_, rhs_arena
+  );
+  swap(_impl_.method_id_, other->_impl_.method_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcBatchEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Krpcheader_2eproto_getter, &descriptor_table_Krpcheader_2eproto_once,
+      file_level_metadata_Krpcheader_2eproto[1]);
+}
+
+// ===================================================================
+
+class RpcBatchRequest::_Internal {
+ public:
+};
+
+RpcBatchRequest::RpcBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Krpc.RpcBatchRequest)
+}
+RpcBatchRequest::RpcBatchRequest(const RpcBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:Krpc.RpcBatchRequest)
+}
+
+inline void RpcBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RpcBatchRequest::~RpcBatchRequest() {
+  // @@protoc_insertion_point(destructor:Krpc.RpcBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RpcBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void RpcBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RpcBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:Krpc.RpcBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .Krpc.RpcBatchEntry entries = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RpcBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Krpc.RpcBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .Krpc.RpcBatchEntry entries = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Krpc.RpcBatchRequest)
+  return target;
+}
+
+size_t RpcBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Krpc.RpcBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Krpc.RpcBatchEntry entries = 1;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcBatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcBatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcBatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void RpcBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcBatchRequest*>(&to_msg);
+  auto& from = static_cast<const RpcBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Krpc.RpcBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RpcBatchRequest::CopyFrom(const RpcBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Krpc.RpcBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RpcBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void RpcBatchRequest::InternalSwap(RpcBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcBatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Krpcheader_2eproto_getter, &descriptor_table_Krpcheader_2eproto_once,
+      file_level_metadata_Krpcheader_2eproto[2]);
+}
+
+// ===================================================================
+
+class RpcResponseHeader::_Internal {
+ public:
+};
+
+RpcResponseHeader::RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Krpc.RpcResponseHeader)
+}
+RpcResponseHeader::RpcResponseHeader(const RpcResponseHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcResponseHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.body_size_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_text().empty()) {
+    _this->_impl_.error_text_.Set(from._internal_error_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:Krpc.RpcResponseHeader)
+}
+
+inline void RpcResponseHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.body_size_){0u}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RpcResponseHeader::~RpcResponseHeader() {
+  // @@protoc_insertion_point(destructor:Krpc.RpcResponseHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RpcResponseHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_text_.Destroy();
+}
+
+void RpcResponseHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RpcResponseHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:Krpc.RpcResponseHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_text_.ClearToEmpty();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.status_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcResponseHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 request_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 body_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.body_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Krpc.RpcStatus status = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::Krpc::RpcStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes error_text = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_error_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RpcResponseHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Krpc.RpcResponseHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_request_id(), target);
+  }
+
+  // uint32 body_size = 2;
+  if (this->_internal_body_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_body_size(), target);
+  }
+
+  // .Krpc.RpcStatus status = 3;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_status(), target);
+  }
+
+  // bytes error_text = 4;
+  if (!this->_internal_error_text().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_error_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Krpc.RpcResponseHeader)
+  return target;
+}
+
+size_t RpcResponseHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Krpc.RpcResponseHeader)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes error_text = 4;
+  if (!this->_internal_error_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_error_text());
+  }
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // uint32 body_size = 2;
+  if (this->_internal_body_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_body_size());
+  }
+
+  // .Krpc.RpcStatus status = 3;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcResponseHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcResponseHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcResponseHeader::GetClassData() const { return &_class_data_; }
+
+
+void RpcResponseHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcResponseHeader*>(&to_msg);
+  auto& from = static_cast<const RpcResponseHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Krpc.RpcResponseHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_text().empty()) {
+    _this->_internal_set_error_text(from._internal_error_text());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_body_size() != 0) {
+    _this->_internal_set_body_size(from._internal_body_size());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RpcResponseHeader::CopyFrom(const RpcResponseHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Krpc.RpcResponseHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RpcResponseHeader::IsInitialized() const {
+  return true;
+}
+
+void RpcResponseHeader::InternalSwap(RpcResponseHeader* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_text_, lhs_arena,
+      &other->_impl_.error_text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcResponseHeader, _impl_.status_)
+      + sizeof(RpcResponseHeader::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(RpcResponseHeader, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcResponseHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Krpcheader_2eproto_getter, &descriptor_table_Krpcheader_2eproto_once,
+      file_level_metadata_Krpcheader_2eproto[3]);
+}
+
+// ===================================================================
+
+class RpcBatchResult::_Internal {
+ public:
+};
+
+RpcBatchResult::RpcBatchResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Krpc.RpcBatchResult)
+}
+RpcBatchResult::RpcBatchResult(const RpcBatchResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcBatchResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_text().empty()) {
+    _this->_impl_.error_text_.Set(from._internal_error_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_body().empty()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:Krpc.RpcBatchResult)
+}
+
+inline void RpcBatchResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RpcBatchResult::~RpcBatchResult() {
+  // @@protoc_insertion_point(destructor:Krpc.RpcBatchResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RpcBatchResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_text_.Destroy();
+  _impl_.body_.Destroy();
+}
+
+void RpcBatchResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RpcBatchResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:Krpc.RpcBatchResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_text_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
+  _impl_.status_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcBatchResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .Krpc.RpcStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::Krpc::RpcStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes error_text = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes body = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RpcBatchResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Krpc.RpcBatchResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .Krpc.RpcStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // bytes error_text = 2;
+  if (!this->_internal_error_text().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_error_text(), target);
+  }
+
+  // bytes body = 3;
+  if (!this->_internal_body().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_body(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Krpc.RpcBatchResult)
+  return target;
+}
+
+size_t RpcBatchResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Krpc.RpcBatchResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes error_text = 2;
+  if (!this->_internal_error_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_error_text());
+  }
+
+  // bytes body = 3;
+  if (!this->_internal_body().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_body());
+  }
+
+  // .Krpc.RpcStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcBatchResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcBatchResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcBatchResult::GetClassData() const { return &_class_data_; }
+
+
+void RpcBatchResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcBatchResult*>(&to_msg);
+  auto& from = static_cast<const RpcBatchResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Krpc.RpcBatchResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_text().empty()) {
+    _this->_internal_set_error_text(from._internal_error_text());
+  }
+  if (!from._internal_body().empty()) {
+    _this->_internal_set_body(from._internal_body());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RpcBatchResult::CopyFrom(const RpcBatchResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Krpc.RpcBatchResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RpcBatchResult::IsInitialized() const {
+  return true;
+}
+
+void RpcBatchResult::InternalSwap(RpcBatchResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_text_, lhs_arena,
+      &other->_impl_.error_text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcBatchResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Krpcheader_2eproto_getter, &descriptor_table_Krpcheader_2eproto_once,
+      file_level_metadata_Krpcheader_2eproto[4]);
+}
+
+// ===================================================================
+
+class RpcBatchResponse::_Internal {
+ public:
+};
+
+RpcBatchResponse::RpcBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Krpc.RpcBatchResponse)
+}
+RpcBatchResponse::RpcBatchResponse(const RpcBatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcBatchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:Krpc.RpcBatchResponse)
+}
+
+inline void RpcBatchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RpcBatchResponse::~RpcBatchResponse() {
+  // @@protoc_insertion_point(destructor:Krpc.RpcBatchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RpcBatchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+}
+
+void RpcBatchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RpcBatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:Krpc.RpcBatchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcBatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .Krpc.RpcBatchResult results = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RpcBatchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Krpc.RpcBatchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .Krpc.RpcBatchResult results = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Krpc.RpcBatchResponse)
+  return target;
+}
+
+size_t RpcBatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Krpc.RpcBatchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Krpc.RpcBatchResult results = 1;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcBatchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcBatchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcBatchResponse::GetClassData() const { return &_class_data_; }
+
+
+void RpcBatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcBatchResponse*>(&to_msg);
+  auto& from = static_cast<const RpcBatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Krpc.RpcBatchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RpcBatchResponse::CopyFrom(const RpcBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Krpc.RpcBatchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RpcBatchResponse::IsInitialized() const {
+  return true;
+}
+
+void RpcBatchResponse::InternalSwap(RpcBatchResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcBatchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Krpcheader_2eproto_getter, &descriptor_table_Krpcheader_2eproto_once,
+      file_level_metadata_Krpcheader_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Krpc
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Krpc::RpcHeader*
+Arena::CreateMaybeMessage< ::Krpc::RpcHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Krpc::RpcHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Krpc::RpcBatchEntry*
+Arena::CreateMaybeMessage< ::Krpc::RpcBatchEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Krpc::RpcBatchEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Krpc::RpcBatchRequest*
+Arena::CreateMaybeMessage< ::Krpc::RpcBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Krpc::RpcBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Krpc::RpcResponseHeader*
+Arena::CreateMaybeMessage< ::Krpc::RpcResponseHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Krpc::RpcResponseHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Krpc::RpcBatchResult*
+Arena::CreateMaybeMessage< ::Krpc::RpcBatchResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Krpc::RpcBatchResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Krpc::RpcBatchResponse*
+Arena::CreateMaybeMessage< ::Krpc::RpcBatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Krpc::RpcBatchResponse >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,14 +23,13 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -43,34 +42,80 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_Krpcheader_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Krpcheader_2eproto;
 namespace Krpc {
+class RpcBatchEntry;
+struct RpcBatchEntryDefaultTypeInternal;
+extern RpcBatchEntryDefaultTypeInternal _RpcBatchEntry_default_instance_;
+class RpcBatchRequest;
+struct RpcBatchRequestDefaultTypeInternal;
+extern RpcBatchRequestDefaultTypeInternal _RpcBatchRequest_default_instance_;
+class RpcBatchResponse;
+struct RpcBatchResponseDefaultTypeInternal;
+extern RpcBatchResponseDefaultTypeInternal _RpcBatchResponse_default_instance_;
+class RpcBatchResult;
+struct RpcBatchResultDefaultTypeInternal;
+extern RpcBatchResultDefaultTypeInternal _RpcBatchResult_default_instance_;
 class RpcHeader;
-class RpcHeaderDefaultTypeInternal;
+struct RpcHeaderDefaultTypeInternal;
 extern RpcHeaderDefaultTypeInternal _RpcHeader_default_instance_;
+class RpcResponseHeader;
+struct RpcResponseHeaderDefaultTypeInternal;
+extern RpcResponseHeaderDefaultTypeInternal _RpcResponseHeader_default_instance_;
 }  // namespace Krpc
 PROTOBUF_NAMESPACE_OPEN
+template<> ::Krpc::RpcBatchEntry* Arena::CreateMaybeMessage<::Krpc::RpcBatchEntry>(Arena*);
+template<> ::Krpc::RpcBatchRequest* Arena::CreateMaybeMessage<::Krpc::RpcBatchRequest>(Arena*);
+template<> ::Krpc::RpcBatchResponse* Arena::CreateMaybeMessage<::Krpc::RpcBatchResponse>(Arena*);
+template<> ::Krpc::RpcBatchResult* Arena::CreateMaybeMessage<::Krpc::RpcBatchResult>(Arena*);
 template<> ::Krpc::RpcHeader* Arena::CreateMaybeMessage<::Krpc::RpcHeader>(Arena*);
+template<> ::Krpc::RpcResponseHeader* Arena::CreateMaybeMessage<::Krpc::RpcResponseHeader>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace Krpc {
 
+enum RpcStatus : int {
+  RPC_OK = 0,
+  RPC_SERVICE_ERROR = 1,
+  RPC_METHOD_NOT_FOUND = 2,
+  RPC_BAD_REQUEST = 3,
+  RPC_INTERNAL_ERROR = 4,
+  RPC_TIMEOUT = 5,
+  RPC_CANCELED = 6,
+  RPC_NETWORK_ERROR = 7,
+  RPC_SERVICE_UNAVAILABLE = 8,
+  RPC_BAD_RESPONSE = 9,
+  RpcStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RpcStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RpcStatus_IsValid(int value);
+constexpr RpcStatus RpcStatus_MIN = RPC_OK;
+constexpr RpcStatus RpcStatus_MAX = RPC_BAD_RESPONSE;
+constexpr int RpcStatus_ARRAYSIZE = RpcStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RpcStatus_descriptor();
+template<typename T>
+inline const std::string& RpcStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RpcStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RpcStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RpcStatus_descriptor(), enum_t_value);
+}
+inline bool RpcStatus_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RpcStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RpcStatus>(
+    RpcStatus_descriptor(), name, value);
+}
 // ===================================================================
 
-class RpcHeader PROTOBUF_FINAL :
+class RpcHeader final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Krpc.RpcHeader) */ {
  public:
-  inline RpcHeader() : RpcHeader(nullptr) {};
-  virtual ~RpcHeader();
+  inline RpcHeader() : RpcHeader(nullptr) {}
+  ~RpcHeader() override;
+  explicit PROTOBUF_CONSTEXPR RpcHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RpcHeader(const RpcHeader& from);
   RpcHeader(RpcHeader&& from) noexcept
@@ -83,8 +128,13 @@ class RpcHeader PROTOBUF_FINAL :
     return *this;
   }
   inline RpcHeader& operator=(RpcHeader&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -95,164 +145,1046 @@ class RpcHeader PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcHeader& default_instance() {
+    return *internal_default_instance();
   }
-  static const RpcHeader& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RpcHeader* internal_default_instance() {
     return reinterpret_cast<const RpcHeader*>(
                &_RpcHeader_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    0;
+
+  friend void swap(RpcHeader& a, RpcHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcHeader& from) {
+    RpcHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Krpc.RpcHeader";
+  }
+  protected:
+  explicit RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceNameFieldNumber = 1,
+    kMethodNameFieldNumber = 2,
+    kRequestIdFieldNumber = 4,
+    kArgsSizeFieldNumber = 3,
+    kTimeoutMsFieldNumber = 5,
+    kMethodIdFieldNumber = 7,
+    kCancelFieldNumber = 6,
+    kBatchFieldNumber = 8,
+  };
+  // bytes service_name = 1;
+  void clear_service_name();
+  const std::string& service_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
+  private:
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
+  public:
+
+  // bytes method_name = 2;
+  void clear_method_name();
+  const std::string& method_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method_name();
+  PROTOBUF_NODISCARD std::string* release_method_name();
+  void set_allocated_method_name(std::string* method_name);
+  private:
+  const std::string& _internal_method_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method_name(const std::string& value);
+  std::string* _internal_mutable_method_name();
+  public:
+
+  // uint64 request_id = 4;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint32 args_size = 3;
+  void clear_args_size();
+  uint32_t args_size() const;
+  void set_args_size(uint32_t value);
+  private:
+  uint32_t _internal_args_size() const;
+  void _internal_set_args_size(uint32_t value);
+  public:
+
+  // uint32 timeout_ms = 5;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
+  public:
+
+  // fixed32 method_id = 7;
+  void clear_method_id();
+  uint32_t method_id() const;
+  void set_method_id(uint32_t value);
+  private:
+  uint32_t _internal_method_id() const;
+  void _internal_set_method_id(uint32_t value);
+  public:
+
+  // bool cancel = 6;
+  void clear_cancel();
+  bool cancel() const;
+  void set_cancel(bool value);
+  private:
+  bool _internal_cancel() const;
+  void _internal_set_cancel(bool value);
+  public:
+
+  // bool batch = 8;
+  void clear_batch();
+  bool batch() const;
+  void set_batch(bool value);
+  private:
+  bool _internal_batch() const;
+  void _internal_set_batch(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Krpc.RpcHeader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
+    uint64_t request_id_;
+    uint32_t args_size_;
+    uint32_t timeout_ms_;
+    uint32_t method_id_;
+    bool cancel_;
+    bool batch_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Krpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RpcBatchEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Krpc.RpcBatchEntry) */ {
+ public:
+  inline RpcBatchEntry() : RpcBatchEntry(nullptr) {}
+  ~RpcBatchEntry() override;
+  explicit PROTOBUF_CONSTEXPR RpcBatchEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcBatchEntry(const RpcBatchEntry& from);
+  RpcBatchEntry(RpcBatchEntry&& from) noexcept
+    : RpcBatchEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcBatchEntry& operator=(const RpcBatchEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcBatchEntry& operator=(RpcBatchEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcBatchEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcBatchEntry* internal_default_instance() {
+    return reinterpret_cast<const RpcBatchEntry*>(
+               &_RpcBatchEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RpcBatchEntry& a, RpcBatchEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcBatchEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcBatchEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcBatchEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcBatchEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcBatchEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcBatchEntry& from) {
+    RpcBatchEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcBatchEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Krpc.RpcBatchEntry";
+  }
+  protected:
+  explicit RpcBatchEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgsFieldNumber = 2,
+    kMethodIdFieldNumber = 1,
+  };
+  // bytes args = 2;
+  void clear_args();
+  const std::string& args() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_args(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_args();
+  PROTOBUF_NODISCARD std::string* release_args();
+  void set_allocated_args(std::string* args);
+  private:
+  const std::string& _internal_args() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(const std::string& value);
+  std::string* _internal_mutable_args();
+  public:
+
+  // fixed32 method_id = 1;
+  void clear_method_id();
+  uint32_t method_id() const;
+  void set_method_id(uint32_t value);
+  private:
+  uint32_t _internal_method_id() const;
+  void _internal_set_method_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Krpc.RpcBatchEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
+    uint32_t method_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Krpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RpcBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Krpc.RpcBatchRequest) */ {
+ public:
+  inline RpcBatchRequest() : RpcBatchRequest(nullptr) {}
+  ~RpcBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR RpcBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcBatchRequest(const RpcBatchRequest& from);
+  RpcBatchRequest(RpcBatchRequest&& from) noexcept
+    : RpcBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcBatchRequest& operator=(const RpcBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcBatchRequest& operator=(RpcBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const RpcBatchRequest*>(
+               &_RpcBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(RpcBatchRequest& a, RpcBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcBatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcBatchRequest& from) {
+    RpcBatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcBatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Krpc.RpcBatchRequest";
+  }
+  protected:
+  explicit RpcBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 1,
+  };
+  // repeated .Krpc.RpcBatchEntry entries = 1;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::Krpc::RpcBatchEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchEntry >*
+      mutable_entries();
+  private:
+  const ::Krpc::RpcBatchEntry& _internal_entries(int index) const;
+  ::Krpc::RpcBatchEntry* _internal_add_entries();
+  public:
+  const ::Krpc::RpcBatchEntry& entries(int index) const;
+  ::Krpc::RpcBatchEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchEntry >&
+      entries() const;
+
+  // @@protoc_insertion_point(class_scope:Krpc.RpcBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchEntry > entries_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Krpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RpcResponseHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Krpc.RpcResponseHeader) */ {
+ public:
+  inline RpcResponseHeader() : RpcResponseHeader(nullptr) {}
+  ~RpcResponseHeader() override;
+  explicit PROTOBUF_CONSTEXPR RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcResponseHeader(const RpcResponseHeader& from);
+  RpcResponseHeader(RpcResponseHeader&& from) noexcept
+    : RpcResponseHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcResponseHeader& operator=(const RpcResponseHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcResponseHeader& operator=(RpcResponseHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcResponseHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcResponseHeader* internal_default_instance() {
+    return reinterpret_cast<const RpcResponseHeader*>(
+               &_RpcResponseHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RpcResponseHeader& a, RpcResponseHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcResponseHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcResponseHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcResponseHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcResponseHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcResponseHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcResponseHeader& from) {
+    RpcResponseHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcResponseHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Krpc.RpcResponseHeader";
+  }
+  protected:
+  explicit RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorTextFieldNumber = 4,
+    kRequestIdFieldNumber = 1,
+    kBodySizeFieldNumber = 2,
+    kStatusFieldNumber = 3,
+  };
+  // bytes error_text = 4;
+  void clear_error_text();
+  const std::string& error_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_text();
+  PROTOBUF_NODISCARD std::string* release_error_text();
+  void set_allocated_error_text(std::string* error_text);
+  private:
+  const std::string& _internal_error_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_text(const std::string& value);
+  std::string* _internal_mutable_error_text();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint32 body_size = 2;
+  void clear_body_size();
+  uint32_t body_size() const;
+  void set_body_size(uint32_t value);
+  private:
+  uint32_t _internal_body_size() const;
+  void _internal_set_body_size(uint32_t value);
+  public:
+
+  // .Krpc.RpcStatus status = 3;
+  void clear_status();
+  ::Krpc::RpcStatus status() const;
+  void set_status(::Krpc::RpcStatus value);
+  private:
+  ::Krpc::RpcStatus _internal_status() const;
+  void _internal_set_status(::Krpc::RpcStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Krpc.RpcResponseHeader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_text_;
+    uint64_t request_id_;
+    uint32_t body_size_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Krpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RpcBatchResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Krpc.RpcBatchResult) */ {
+ public:
+  inline RpcBatchResult() : RpcBatchResult(nullptr) {}
+  ~RpcBatchResult() override;
+  explicit PROTOBUF_CONSTEXPR RpcBatchResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcBatchResult(const RpcBatchResult& from);
+  RpcBatchResult(RpcBatchResult&& from) noexcept
+    : RpcBatchResult() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcBatchResult& operator=(const RpcBatchResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcBatchResult& operator=(RpcBatchResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcBatchResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcBatchResult* internal_default_instance() {
+    return reinterpret_cast<const RpcBatchResult*>(
+               &_RpcBatchResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(RpcBatchResult& a, RpcBatchResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcBatchResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcBatchResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcBatchResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcBatchResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcBatchResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcBatchResult& from) {
+    RpcBatchResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcBatchResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Krpc.RpcBatchResult";
+  }
+  protected:
+  explicit RpcBatchResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorTextFieldNumber = 2,
+    kBodyFieldNumber = 3,
+    kStatusFieldNumber = 1,
+  };
+  // bytes error_text = 2;
+  void clear_error_text();
+  const std::string& error_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_text();
+  PROTOBUF_NODISCARD std::string* release_error_text();
+  void set_allocated_error_text(std::string* error_text);
+  private:
+  const std::string& _internal_error_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_text(const std::string& value);
+  std::string* _internal_mutable_error_text();
+  public:
+
+  // bytes body = 3;
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // .Krpc.RpcStatus status = 1;
+  void clear_status();
+  ::Krpc::RpcStatus status() const;
+  void set_status(::Krpc::RpcStatus value);
+  private:
+  ::Krpc::RpcStatus _internal_status() const;
+  void _internal_set_status(::Krpc::RpcStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Krpc.RpcBatchResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_text_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Krpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RpcBatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Krpc.RpcBatchResponse) */ {
+ public:
+  inline RpcBatchResponse() : RpcBatchResponse(nullptr) {}
+  ~RpcBatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR RpcBatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcBatchResponse(const RpcBatchResponse& from);
+  RpcBatchResponse(RpcBatchResponse&& from) noexcept
+    : RpcBatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcBatchResponse& operator=(const RpcBatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcBatchResponse& operator=(RpcBatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcBatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcBatchResponse* internal_default_instance() {
+    return reinterpret_cast<const RpcBatchResponse*>(
+               &_RpcBatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  friend void swap(RpcHeader& a, RpcHeader& b) {
+  friend void swap(RpcBatchResponse& a, RpcBatchResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(RpcHeader* other) {
+  inline void Swap(RpcBatchResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RpcHeader* other) {
+  void UnsafeArenaSwap(RpcBatchResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RpcHeader* New() const final {
-    return CreateMaybeMessage<RpcHeader>(nullptr);
+  RpcBatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcBatchResponse>(arena);
   }
-
-  RpcHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RpcHeader>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcBatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcBatchResponse& from) {
+    RpcBatchResponse::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RpcHeader& from);
-  void MergeFrom(const RpcHeader& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RpcHeader* other);
+  void InternalSwap(RpcBatchResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Krpc.RpcHeader";
+    return "Krpc.RpcBatchResponse";
   }
   protected:
-  explicit RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RpcBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_Krpcheader_2eproto);
-    return ::descriptor_table_Krpcheader_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kServiceNameFieldNumber = 1,
-    kMethodNameFieldNumber = 2,
-    kArgsSizeFieldNumber = 3,
+    kResultsFieldNumber = 1,
   };
-  // bytes service_name = 1;
-  void clear_service_name();
-  const std::string& service_name() const;
-  void set_service_name(const std::string& value);
-  void set_service_name(std::string&& value);
-  void set_service_name(const char* value);
-  void set_service_name(const void* value, size_t size);
-  std::string* mutable_service_name();
-  std::string* release_service_name();
-  void set_allocated_service_name(std::string* service_name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_service_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_service_name(
-      std::string* service_name);
-  private:
-  const std::string& _internal_service_name() const;
-  void _internal_set_service_name(const std::string& value);
-  std::string* _internal_mutable_service_name();
-  public:
-
-  // bytes method_name = 2;
-  void clear_method_name();
-  const std::string& method_name() const;
-  void set_method_name(const std::string& value);
-  void set_method_name(std::string&& value);
-  void set_method_name(const char* value);
-  void set_method_name(const void* value, size_t size);
-  std::string* mutable_method_name();
-  std::string* release_method_name();
-  void set_allocated_method_name(std::string* method_name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_method_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_method_name(
-      std::string* method_name);
+  // repeated .Krpc.RpcBatchResult results = 1;
+  int results_size() const;
   private:
-  const std::string& _internal_method_name() const;
-  void _internal_set_method_name(const std::string& value);
-  std::string* _internal_mutable_method_name();
+  int _internal_results_size() const;
   public:
-
-  // uint32 args_size = 3;
-  void clear_args_size();
-  ::PROTOBUF_NAMESPACE_ID::uint32 args_size() const;
-  void set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void clear_results();
+  ::Krpc::RpcBatchResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchResult >*
+      mutable_results();
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_args_size() const;
-  void _internal_set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::Krpc::RpcBatchResult& _internal_results(int index) const;
+  ::Krpc::RpcBatchResult* _internal_add_results();
   public:
+  const ::Krpc::RpcBatchResult& results(int index) const;
+  ::Krpc::RpcBatchResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchResult >&
+      results() const;
 
-  // @@protoc_insertion_point(class_scope:Krpc.RpcHeader)
+  // @@protoc_insertion_point(class_scope:Krpc.RpcBatchResponse)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 args_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchResult > results_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_Krpcheader_2eproto;
 };
 // ===================================================================
@@ -268,54 +1200,38 @@ class RpcHeader PROTOBUF_FINAL :
 
 // bytes service_name = 1;
 inline void RpcHeader::clear_service_name() {
-  service_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.service_name_.ClearToEmpty();
 }
 inline const std::string& RpcHeader::service_name() const {
   // @@protoc_insertion_point(field_get:Krpc.RpcHeader.service_name)
   return _internal_service_name();
 }
-inline void RpcHeader::set_service_name(const std::string& value) {
-  _internal_set_service_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_service_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Krpc.RpcHeader.service_name)
 }
 inline std::string* RpcHeader::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
   // @@protoc_insertion_point(field_mutable:Krpc.RpcHeader.service_name)
-  return _internal_mutable_service_name();
+  return _s;
 }
 inline const std::string& RpcHeader::_internal_service_name() const {
-  return service_name_.Get();
+  return _impl_.service_name_.Get();
 }
 inline void RpcHeader::_internal_set_service_name(const std::string& value) {
   
-  service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void RpcHeader::set_service_name(std::string&& value) {
-  
-  service_name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Krpc.RpcHeader.service_name)
-}
-inline void RpcHeader::set_service_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Krpc.RpcHeader.service_name)
-}
-inline void RpcHeader::set_service_name(const void* value,
-    size_t size) {
-  
-  service_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Krpc.RpcHeader.service_name)
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RpcHeader::_internal_mutable_service_name() {
   
-  return service_name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RpcHeader::release_service_name() {
   // @@protoc_insertion_point(field_release:Krpc.RpcHeader.service_name)
-  return service_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.service_name_.Release();
 }
 inline void RpcHeader::set_allocated_service_name(std::string* service_name) {
   if (service_name != nullptr) {
@@ -323,80 +1239,49 @@ inline void RpcHeader::set_allocated_service_name(std::string* service_name) {
   } else {
     
   }
-  service_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), service_name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Krpc.RpcHeader.service_name)
-}
-inline std::string* RpcHeader::unsafe_arena_release_service_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Krpc.RpcHeader.service_name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return service_name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void RpcHeader::unsafe_arena_set_allocated_service_name(
-    std::string* service_name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (service_name != nullptr) {
-    
-  } else {
-    
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
   }
-  service_name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      service_name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Krpc.RpcHeader.service_name)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Krpc.RpcHeader.service_name)
 }
 
 // bytes method_name = 2;
 inline void RpcHeader::clear_method_name() {
-  method_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.method_name_.ClearToEmpty();
 }
 inline const std::string& RpcHeader::method_name() const {
   // @@protoc_insertion_point(field_get:Krpc.RpcHeader.method_name)
   return _internal_method_name();
 }
-inline void RpcHeader::set_method_name(const std::string& value) {
-  _internal_set_method_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_method_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.method_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Krpc.RpcHeader.method_name)
 }
 inline std::string* RpcHeader::mutable_method_name() {
+  std::string* _s = _internal_mutable_method_name();
   // @@protoc_insertion_point(field_mutable:Krpc.RpcHeader.method_name)
-  return _internal_mutable_method_name();
+  return _s;
 }
 inline const std::string& RpcHeader::_internal_method_name() const {
-  return method_name_.Get();
+  return _impl_.method_name_.Get();
 }
 inline void RpcHeader::_internal_set_method_name(const std::string& value) {
   
-  method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void RpcHeader::set_method_name(std::string&& value) {
-  
-  method_name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Krpc.RpcHeader.method_name)
-}
-inline void RpcHeader::set_method_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Krpc.RpcHeader.method_name)
-}
-inline void RpcHeader::set_method_name(const void* value,
-    size_t size) {
-  
-  method_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Krpc.RpcHeader.method_name)
+  _impl_.method_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RpcHeader::_internal_mutable_method_name() {
   
-  return method_name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.method_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RpcHeader::release_method_name() {
   // @@protoc_insertion_point(field_release:Krpc.RpcHeader.method_name)
-  return method_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.method_name_.Release();
 }
 inline void RpcHeader::set_allocated_method_name(std::string* method_name) {
   if (method_name != nullptr) {
@@ -404,58 +1289,563 @@ inline void RpcHeader::set_allocated_method_name(std::string* method_name) {
   } else {
     
   }
-  method_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), method_name,
-      GetArena());
+  _impl_.method_name_.SetAllocated(method_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_name_.IsDefault()) {
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Krpc.RpcHeader.method_name)
 }
-inline std::string* RpcHeader::unsafe_arena_release_method_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Krpc.RpcHeader.method_name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+
+// uint32 args_size = 3;
+inline void RpcHeader::clear_args_size() {
+  _impl_.args_size_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_args_size() const {
+  return _impl_.args_size_;
+}
+inline uint32_t RpcHeader::args_size() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcHeader.args_size)
+  return _internal_args_size();
+}
+inline void RpcHeader::_internal_set_args_size(uint32_t value) {
   
-  return method_name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.args_size_ = value;
 }
-inline void RpcHeader::unsafe_arena_set_allocated_method_name(
-    std::string* method_name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (method_name != nullptr) {
+inline void RpcHeader::set_args_size(uint32_t value) {
+  _internal_set_args_size(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcHeader.args_size)
+}
+
+// uint64 request_id = 4;
+inline void RpcHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t RpcHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t RpcHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcHeader.request_id)
+  return _internal_request_id();
+}
+inline void RpcHeader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void RpcHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcHeader.request_id)
+}
+
+// uint32 timeout_ms = 5;
+inline void RpcHeader::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline uint32_t RpcHeader::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcHeader.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void RpcHeader::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void RpcHeader::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcHeader.timeout_ms)
+}
+
+// bool cancel = 6;
+inline void RpcHeader::clear_cancel() {
+  _impl_.cancel_ = false;
+}
+inline bool RpcHeader::_internal_cancel() const {
+  return _impl_.cancel_;
+}
+inline bool RpcHeader::cancel() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcHeader.cancel)
+  return _internal_cancel();
+}
+inline void RpcHeader::_internal_set_cancel(bool value) {
+  
+  _impl_.cancel_ = value;
+}
+inline void RpcHeader::set_cancel(bool value) {
+  _internal_set_cancel(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcHeader.cancel)
+}
+
+// fixed32 method_id = 7;
+inline void RpcHeader::clear_method_id() {
+  _impl_.method_id_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_method_id() const {
+  return _impl_.method_id_;
+}
+inline uint32_t RpcHeader::method_id() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcHeader.method_id)
+  return _internal_method_id();
+}
+inline void RpcHeader::_internal_set_method_id(uint32_t value) {
+  
+  _impl_.method_id_ = value;
+}
+inline void RpcHeader::set_method_id(uint32_t value) {
+  _internal_set_method_id(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcHeader.method_id)
+}
+
+// bool batch = 8;
+inline void RpcHeader::clear_batch() {
+  _impl_.batch_ = false;
+}
+inline bool RpcHeader::_internal_batch() const {
+  return _impl_.batch_;
+}
+inline bool RpcHeader::batch() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcHeader.batch)
+  return _internal_batch();
+}
+inline void RpcHeader::_internal_set_batch(bool value) {
+  
+  _impl_.batch_ = value;
+}
+inline void RpcHeader::set_batch(bool value) {
+  _internal_set_batch(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcHeader.batch)
+}
+
+// -------------------------------------------------------------------
+
+// RpcBatchEntry
+
+// fixed32 method_id = 1;
+inline void RpcBatchEntry::clear_method_id() {
+  _impl_.method_id_ = 0u;
+}
+inline uint32_t RpcBatchEntry::_internal_method_id() const {
+  return _impl_.method_id_;
+}
+inline uint32_t RpcBatchEntry::method_id() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcBatchEntry.method_id)
+  return _internal_method_id();
+}
+inline void RpcBatchEntry::_internal_set_method_id(uint32_t value) {
+  
+  _impl_.method_id_ = value;
+}
+inline void RpcBatchEntry::set_method_id(uint32_t value) {
+  _internal_set_method_id(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcBatchEntry.method_id)
+}
+
+// bytes args = 2;
+inline void RpcBatchEntry::clear_args() {
+  _impl_.args_.ClearToEmpty();
+}
+inline const std::string& RpcBatchEntry::args() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcBatchEntry.args)
+  return _internal_args();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcBatchEntry::set_args(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.args_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Krpc.RpcBatchEntry.args)
+}
+inline std::string* RpcBatchEntry::mutable_args() {
+  std::string* _s = _internal_mutable_args();
+  // @@protoc_insertion_point(field_mutable:Krpc.RpcBatchEntry.args)
+  return _s;
+}
+inline const std::string& RpcBatchEntry::_internal_args() const {
+  return _impl_.args_.Get();
+}
+inline void RpcBatchEntry::_internal_set_args(const std::string& value) {
+  
+  _impl_.args_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcBatchEntry::_internal_mutable_args() {
+  
+  return _impl_.args_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcBatchEntry::release_args() {
+  // @@protoc_insertion_point(field_release:Krpc.RpcBatchEntry.args)
+  return _impl_.args_.Release();
+}
+inline void RpcBatchEntry::set_allocated_args(std::string* args) {
+  if (args != nullptr) {
     
   } else {
     
   }
-  method_name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      method_name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Krpc.RpcHeader.method_name)
+  _impl_.args_.SetAllocated(args, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.args_.IsDefault()) {
+    _impl_.args_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Krpc.RpcBatchEntry.args)
 }
 
-// uint32 args_size = 3;
-inline void RpcHeader::clear_args_size() {
-  args_size_ = 0u;
+// -------------------------------------------------------------------
+
+// RpcBatchRequest
+
+// repeated .Krpc.RpcBatchEntry entries = 1;
+inline int RpcBatchRequest::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 RpcHeader::_internal_args_size() const {
-  return args_size_;
+inline int RpcBatchRequest::entries_size() const {
+  return _internal_entries_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 RpcHeader::args_size() const {
-  // @@protoc_insertion_point(field_get:Krpc.RpcHeader.args_size)
-  return _internal_args_size();
+inline void RpcBatchRequest::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::Krpc::RpcBatchEntry* RpcBatchRequest::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:Krpc.RpcBatchRequest.entries)
+  return _impl_.entries_.Mutable(index);
 }
-inline void RpcHeader::_internal_set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchEntry >*
+RpcBatchRequest::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:Krpc.RpcBatchRequest.entries)
+  return &_impl_.entries_;
+}
+inline const ::Krpc::RpcBatchEntry& RpcBatchRequest::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::Krpc::RpcBatchEntry& RpcBatchRequest::entries(int index) const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcBatchRequest.entries)
+  return _internal_entries(index);
+}
+inline ::Krpc::RpcBatchEntry* RpcBatchRequest::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::Krpc::RpcBatchEntry* RpcBatchRequest::add_entries() {
+  ::Krpc::RpcBatchEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:Krpc.RpcBatchRequest.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchEntry >&
+RpcBatchRequest::entries() const {
+  // @@protoc_insertion_point(field_list:Krpc.RpcBatchRequest.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// RpcResponseHeader
+
+// uint64 request_id = 1;
+inline void RpcResponseHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t RpcResponseHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t RpcResponseHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcResponseHeader.request_id)
+  return _internal_request_id();
+}
+inline void RpcResponseHeader::_internal_set_request_id(uint64_t value) {
   
-  args_size_ = value;
+  _impl_.request_id_ = value;
 }
-inline void RpcHeader::set_args_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_args_size(value);
-  // @@protoc_insertion_point(field_set:Krpc.RpcHeader.args_size)
+inline void RpcResponseHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcResponseHeader.request_id)
+}
+
+// uint32 body_size = 2;
+inline void RpcResponseHeader::clear_body_size() {
+  _impl_.body_size_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_body_size() const {
+  return _impl_.body_size_;
+}
+inline uint32_t RpcResponseHeader::body_size() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcResponseHeader.body_size)
+  return _internal_body_size();
+}
+inline void RpcResponseHeader::_internal_set_body_size(uint32_t value) {
+  
+  _impl_.body_size_ = value;
+}
+inline void RpcResponseHeader::set_body_size(uint32_t value) {
+  _internal_set_body_size(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcResponseHeader.body_size)
+}
+
+// .Krpc.RpcStatus status = 3;
+inline void RpcResponseHeader::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::Krpc::RpcStatus RpcResponseHeader::_internal_status() const {
+  return static_cast< ::Krpc::RpcStatus >(_impl_.status_);
+}
+inline ::Krpc::RpcStatus RpcResponseHeader::status() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcResponseHeader.status)
+  return _internal_status();
+}
+inline void RpcResponseHeader::_internal_set_status(::Krpc::RpcStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void RpcResponseHeader::set_status(::Krpc::RpcStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcResponseHeader.status)
+}
+
+// bytes error_text = 4;
+inline void RpcResponseHeader::clear_error_text() {
+  _impl_.error_text_.ClearToEmpty();
+}
+inline const std::string& RpcResponseHeader::error_text() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcResponseHeader.error_text)
+  return _internal_error_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcResponseHeader::set_error_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_text_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Krpc.RpcResponseHeader.error_text)
+}
+inline std::string* RpcResponseHeader::mutable_error_text() {
+  std::string* _s = _internal_mutable_error_text();
+  // @@protoc_insertion_point(field_mutable:Krpc.RpcResponseHeader.error_text)
+  return _s;
+}
+inline const std::string& RpcResponseHeader::_internal_error_text() const {
+  return _impl_.error_text_.Get();
+}
+inline void RpcResponseHeader::_internal_set_error_text(const std::string& value) {
+  
+  _impl_.error_text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::_internal_mutable_error_text() {
+  
+  return _impl_.error_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::release_error_text() {
+  // @@protoc_insertion_point(field_release:Krpc.RpcResponseHeader.error_text)
+  return _impl_.error_text_.Release();
+}
+inline void RpcResponseHeader::set_allocated_error_text(std::string* error_text) {
+  if (error_text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_text_.SetAllocated(error_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_text_.IsDefault()) {
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Krpc.RpcResponseHeader.error_text)
+}
+
+// -------------------------------------------------------------------
+
+// RpcBatchResult
+
+// .Krpc.RpcStatus status = 1;
+inline void RpcBatchResult::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::Krpc::RpcStatus RpcBatchResult::_internal_status() const {
+  return static_cast< ::Krpc::RpcStatus >(_impl_.status_);
+}
+inline ::Krpc::RpcStatus RpcBatchResult::status() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcBatchResult.status)
+  return _internal_status();
+}
+inline void RpcBatchResult::_internal_set_status(::Krpc::RpcStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void RpcBatchResult::set_status(::Krpc::RpcStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:Krpc.RpcBatchResult.status)
+}
+
+// bytes error_text = 2;
+inline void RpcBatchResult::clear_error_text() {
+  _impl_.error_text_.ClearToEmpty();
+}
+inline const std::string& RpcBatchResult::error_text() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcBatchResult.error_text)
+  return _internal_error_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcBatchResult::set_error_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_text_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Krpc.RpcBatchResult.error_text)
+}
+inline std::string* RpcBatchResult::mutable_error_text() {
+  std::string* _s = _internal_mutable_error_text();
+  // @@protoc_insertion_point(field_mutable:Krpc.RpcBatchResult.error_text)
+  return _s;
+}
+inline const std::string& RpcBatchResult::_internal_error_text() const {
+  return _impl_.error_text_.Get();
+}
+inline void RpcBatchResult::_internal_set_error_text(const std::string& value) {
+  
+  _impl_.error_text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcBatchResult::_internal_mutable_error_text() {
+  
+  return _impl_.error_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcBatchResult::release_error_text() {
+  // @@protoc_insertion_point(field_release:Krpc.RpcBatchResult.error_text)
+  return _impl_.error_text_.Release();
+}
+inline void RpcBatchResult::set_allocated_error_text(std::string* error_text) {
+  if (error_text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_text_.SetAllocated(error_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_text_.IsDefault()) {
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Krpc.RpcBatchResult.error_text)
+}
+
+// bytes body = 3;
+inline void RpcBatchResult::clear_body() {
+  _impl_.body_.ClearToEmpty();
+}
+inline const std::string& RpcBatchResult::body() const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcBatchResult.body)
+  return _internal_body();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcBatchResult::set_body(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.body_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Krpc.RpcBatchResult.body)
+}
+inline std::string* RpcBatchResult::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:Krpc.RpcBatchResult.body)
+  return _s;
+}
+inline const std::string& RpcBatchResult::_internal_body() const {
+  return _impl_.body_.Get();
+}
+inline void RpcBatchResult::_internal_set_body(const std::string& value) {
+  
+  _impl_.body_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcBatchResult::_internal_mutable_body() {
+  
+  return _impl_.body_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcBatchResult::release_body() {
+  // @@protoc_insertion_point(field_release:Krpc.RpcBatchResult.body)
+  return _impl_.body_.Release();
+}
+inline void RpcBatchResult::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Krpc.RpcBatchResult.body)
+}
+
+// -------------------------------------------------------------------
+
+// RpcBatchResponse
+
+// repeated .Krpc.RpcBatchResult results = 1;
+inline int RpcBatchResponse::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int RpcBatchResponse::results_size() const {
+  return _internal_results_size();
+}
+inline void RpcBatchResponse::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::Krpc::RpcBatchResult* RpcBatchResponse::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:Krpc.RpcBatchResponse.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchResult >*
+RpcBatchResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:Krpc.RpcBatchResponse.results)
+  return &_impl_.results_;
+}
+inline const ::Krpc::RpcBatchResult& RpcBatchResponse::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::Krpc::RpcBatchResult& RpcBatchResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:Krpc.RpcBatchResponse.results)
+  return _internal_results(index);
+}
+inline ::Krpc::RpcBatchResult* RpcBatchResponse::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::Krpc::RpcBatchResult* RpcBatchResponse::add_results() {
+  ::Krpc::RpcBatchResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:Krpc.RpcBatchResponse.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Krpc::RpcBatchResult >&
+RpcBatchResponse::results() const {
+  // @@protoc_insertion_point(field_list:Krpc.RpcBatchResponse.results)
+  return _impl_.results_;
 }
 
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace Krpc
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::Krpc::RpcStatus> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Krpc::RpcStatus>() {
+  return ::Krpc::RpcStatus_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
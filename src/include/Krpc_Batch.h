@@ -0,0 +1,113 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_Batch.h
+  * @author         : 18483
+  * @brief          : 客户端批量调用
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_BATCH_H
+#define KRPC_KRPC_BATCH_H
+
+#include "Krpc_Channel.h"
+#include "Krpc_Future.h"
+#include <google/protobuf/service.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Krpc {
+class RpcBatchResponse;
+class RpcBatchResult;
+}
+
+/**
+ * @brief 把多个相互独立的异步调用打包进一个请求帧的 RpcChannel
+ * @details 通过 batch 发起的异步调用先序列化请求参数并暂存，Send 时同一服务的所有调用
+ *          打包成一个批量请求（RpcHeader.batch），服务端逐个派发（配置了业务线程池时并行执行），
+ *          全部结束后用一个响应帧带回所有结果，再由客户端逐个设置 controller 和 response 并执行各自的 done。
+ *          与 KrpcPipeline 相比，多个调用共用一个请求头和响应头，服务端也只需要处理一个请求帧；
+ *          代价是一个批量请求中的调用一起完成，超时时间取其中最短的一个，也不能单独取消。
+ *          同步调用（done 为空）不参与打包，直接按普通方式完成。
+ *          batch 只能在一个线程中使用，析构时发送所有未发送的调用
+ */
+class KrpcBatch : public google::protobuf::RpcChannel {
+public:
+    /**
+     * @param channel 实际完成服务发现、负载均衡和发送的 Channel，生命周期必须长于 batch
+     */
+    explicit KrpcBatch(KrpcChannel *channel);
+    /**
+     * @brief 析构函数 发送所有未发送的调用
+     */
+    virtual ~KrpcBatch();
+    /**
+     * @brief 发起调用，异步调用暂存到 Send 时打包发送，参数与 KrpcChannel::CallMethod 相同
+     */
+    void CallMethod(const ::google::protobuf::MethodDescriptor * method,
+                    ::google::protobuf::RpcController * controller,
+                    const ::google::protobuf::Message * request,
+                    ::google::protobuf::Message * response,
+                    ::google::protobuf::Closure * done) override;
+    /**
+     * @brief 通过生成的 Stub 方法发起异步调用，用法与 KrpcChannel::CallAsync 相同，调用在 Send 时发出
+     */
+    template <typename Stub, typename Request, typename Response>
+    KrpcFuture<Response> CallAsync(void (Stub::*method)(google::protobuf::RpcController *, const Request *,
+                                                        Response *, google::protobuf::Closure *),
+                                   const Request &request, int timeout_ms = 0) {
+        return KrpcCallAsync(this, method, request, timeout_ms);
+    }
+    /**
+     * @brief 发送所有暂存的调用，每个服务一个批量请求
+     */
+    void Send();
+    /**
+     * @brief 暂存的调用数
+     */
+    size_t Size() const { return m_size; }
+
+    /**
+     * @brief 批量请求中的一个调用
+     */
+    struct Entry {
+        google::protobuf::RpcController *controller;
+        google::protobuf::Message *response;
+        google::protobuf::Closure *done;
+    };
+    /**
+     * @brief 批量请求结束，把结果分发给其中的每个调用并执行各自的 done
+     * @param status   整个批量请求的状态 Krpc::RpcStatus，不是 RPC_OK 时所有调用都以该状态失败
+     * @param err      整个批量请求的失败原因
+     * @param response 批量响应，第 i 项是 entries[i] 的结果；status 不是 RPC_OK 时不使用
+     */
+    static void Complete(const std::vector<Entry> &entries, int status, const std::string &err,
+                         const Krpc::RpcBatchResponse *response);
+    /**
+     * @brief 结束批量请求中的一个调用并执行它的 done
+     * @param result 该调用的结果，status 不是 RPC_OK 时不使用；为空时表示批量响应中缺少该项
+     */
+    static void CompleteEntry(const Entry &entry, int status, const std::string &err,
+                              const Krpc::RpcBatchResult *result);
+
+private:
+    /**
+     * @brief 同一服务的一个批量请求，定义在实现文件中
+     */
+    class Group;
+
+    KrpcBatch(const KrpcBatch &) = delete;
+    KrpcBatch& operator=(const KrpcBatch &) = delete;
+
+private:
+    KrpcChannel *m_channel;
+    /// 按服务分组的暂存调用，发送后由各自的批量请求在结束时释放
+    std::vector<Group*> m_groups;
+    size_t m_size;
+};
+
+
+#endif //KRPC_KRPC_BATCH_H
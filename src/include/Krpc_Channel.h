@@ -14,6 +14,16 @@
 
 #include <google/protobuf/service.h>
 #include "zookeeperUtil.h"
+#include "Krpc_LoadBalancer.h"
+#include "Krpc_Future.h"
+#include <memory>
+#include <string>
+
+class KrpcPipeline;
+class KrpcBatch;
+namespace Krpc {
+class RpcHeader;
+}
 
 /**
  * @brief 给客户端进行方法调用的时候，统一接收
@@ -23,13 +33,28 @@ class KrpcChannel : public google::protobuf::RpcChannel {
 public:
     /**
      * @brief 构造函数
-     * @param connectNow 是否立即建立连接
+     * @param connectNow 是否立即建立连接（连接已由连接池统一管理，保留该参数以兼容旧接口）
      */
     KrpcChannel(bool connectNow);
     /**
      * @brief 虚析构函数
      */
     virtual ~KrpcChannel() {}
+    /**
+     * @brief 设置该 Channel 使用的负载均衡策略，默认使用配置项 loadbalance 指定的进程级策略
+     */
+    void SetLoadBalancer(const std::shared_ptr<KrpcLoadBalancer> &balancer) { m_balancer = balancer; }
+    /**
+     * @brief 开启或关闭自动攒批模式，默认由配置项 batch_linger_us / batch_max_size 决定
+     * @details 开启后，该 Channel 发起的调用（同步和异步）在调用线程中选好服务端实例后交给进程级的 KrpcMicroBatcher，
+     *          与其他 Channel、其他线程发往同一实例的调用一起，在 linger_us 微秒内 或 攒够 max_batch 个时
+     *          合并成批量请求发送，服务端拆开处理后用一个响应帧带回，再拆分给各个调用；
+     *          以最多 linger_us 的额外延迟换取更少的请求帧和系统调用。攒批模式下的调用在发送之后不能单独取消。
+     *          需要在发起调用之前设置
+     * @param linger_us 攒批窗口的长度（微秒），0 表示关闭
+     * @param max_batch 一个批量请求最多合并的调用数
+     */
+    void EnableBatching(int linger_us, size_t max_batch);
     /**
      * @brief RPC 调用的核心方法
      * @details 负责将客户端的请求序列化并发送到服务器，同时接收服务端的响应
@@ -37,36 +62,77 @@ public:
      * @param controller rpc 控制器
      * @param request  客户端请求
      * @param response 服务端响应
-     * @param done
+     * @param done 为空时同步调用；不为空时异步调用，调用结束后在客户端事件循环线程中执行
      */
     void CallMethod(const ::google::protobuf::MethodDescriptor * method,
                     ::google::protobuf::RpcController * controller,
                     const ::google::protobuf::Message * request,
                     ::google::protobuf::Message * response,
                     ::google::protobuf::Closure * done) override;
+    /**
+     * @brief 通过生成的 Stub 方法发起异步调用，立即返回结果句柄
+     * @details 例如 channel.CallAsync(&Kuser::UserServiceRpc_Stub::Login, request)。
+     *          请求在返回前已经编码发送，request 不需要在返回后继续有效；
+     *          多个调用共享连接池中的连接，不会为每个调用创建线程
+     * @param method     Stub 的方法
+     * @param request    请求参数
+     * @param timeout_ms 超时时间（毫秒），0 表示使用配置项 rpc_timeout_ms
+     */
+    template <typename Stub, typename Request, typename Response>
+    KrpcFuture<Response> CallAsync(void (Stub::*method)(google::protobuf::RpcController *, const Request *,
+                                                        Response *, google::protobuf::Closure *),
+                                   const Request &request, int timeout_ms = 0) {
+        return KrpcCallAsync(this, method, request, timeout_ms);
+    }
+
 private:
+    friend class KrpcPipeline;
+    friend class KrpcBatch;
+
     /**
-     * @brief 建立新连接
+     * @brief 异步发起一次调用，参数与 CallMethod 相同，done 不能为空；同步调用由 CallMethod 等待 done
+     * @param pipeline 不为空时请求帧先交给 pipeline 暂存，由 pipeline 统一发送
      */
-    bool newConnect(const char *ip, uint16_t port);
+    void StartCall(const ::google::protobuf::MethodDescriptor * method,
+                   ::google::protobuf::RpcController * controller,
+                   const ::google::protobuf::Message * request,
+                   ::google::protobuf::Message * response,
+                   ::google::protobuf::Closure * done,
+                   KrpcPipeline * pipeline);
     /**
-     * @brief 从 ZooKeeper 查询服务地址
-     * @param zkclient zk 客户端
-     * @param service_name 服务名
-     * @param method_name  方法名
-     * @param idx      ip 和 port 分隔符下标
+     * @brief 选好服务端实例后把异步调用交给 KrpcMicroBatcher，参数与 CallMethod 相同，done 不能为空
      */
-    std::string QueryServiceHost(ZkClient *zkclient, std::string service_name,
-                                 std::string method_name, int &idx);
+    void AddToBatch(const ::google::protobuf::MethodDescriptor * method,
+                    ::google::protobuf::RpcController * controller,
+                    const ::google::protobuf::Message * request,
+                    ::google::protobuf::Message * response,
+                    ::google::protobuf::Closure * done);
+    /**
+     * @brief 本次调用的超时时间（毫秒），controller 中未设置时使用配置项 rpc_timeout_ms，0 表示不限时
+     */
+    int CallTimeout(const KrpcController * controller) const;
+    /**
+     * @brief 发送一次请求头已经确定的调用，请求 id、剩余超时时间和参数长度由这里填写
+     * @param service_name 用于服务发现的服务名
+     * @param header       请求头，已经设置好方法 id 或批量标志
+     */
+    void SendCall(const std::string & service_name,
+                  Krpc::RpcHeader * header,
+                  ::google::protobuf::RpcController * controller,
+                  const ::google::protobuf::Message * request,
+                  ::google::protobuf::Message * response,
+                  ::google::protobuf::Closure * done,
+                  KrpcPipeline * pipeline);
+
 private:
-    /// 存放客户端套接字
-    int m_clientfd;
-    std::string service_name;
-    std::string method_name;
-    std::string m_ip;
-    uint16_t m_port;
-    /// 用于划分服务器 ip 和 port 的下标
-    int m_idx;
+    /// 从服务的多个实例中选出本次调用的实例
+    std::shared_ptr<KrpcLoadBalancer> m_balancer;
+    /// controller 中未设置超时时间时使用的超时时间（毫秒），0 表示不限时
+    int m_defaultTimeoutMs;
+    /// 自动攒批窗口的长度（微秒），0 表示未开启
+    int m_batchLingerUs;
+    /// 一个批量请求最多合并的调用数
+    size_t m_batchMaxSize;
 };
 
 
@@ -0,0 +1,194 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ClientConnection.h
+  * @author         : 18483
+  * @brief          : 可多路复用的客户端连接
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_CLIENTCONNECTION_H
+#define KRPC_KRPC_CLIENTCONNECTION_H
+
+#include <muduo/net/Buffer.h>
+#include <muduo/net/EventLoop.h>
+#include <muduo/net/TcpClient.h>
+#include <muduo/net/TcpConnection.h>
+#include <muduo/net/TimerId.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace google {
+namespace protobuf {
+class Message;
+}
+}
+namespace Krpc {
+class RpcHeader;
+}
+
+/**
+ * @brief 客户端到某个服务端的一条 TCP 连接
+ * @details 每个请求携带唯一的 request_id，服务端在响应头中原样带回，
+ *          因此多个线程可以同时在同一条连接上发起调用，响应可以乱序返回。
+ *          底层是 muduo 的 TcpClient，建立连接、发送和接收都在客户端事件循环中以非阻塞方式完成：
+ *          连接建立之前发起的调用先缓存请求帧，连接建立后再统一发出；
+ *          读到的响应按 request_id 交给对应调用的回调，同步调用由 KrpcChannel 在回调中唤醒。
+ *          响应帧格式 { header_size(varint32), RpcResponseHeader:(request_id, body_size, status, error_text), body }
+ */
+class KrpcClientConnection : public std::enable_shared_from_this<KrpcClientConnection> {
+public:
+    /**
+     * @brief 响应回调，通常在事件循环线程中执行
+     * @param status 调用状态 Krpc::RpcStatus，RPC_OK 表示成功收到响应
+     * @param body   成功时为响应消息体，回调可以直接取走其中的数据
+     * @param err    失败时为失败原因
+     */
+    typedef std::function<void(int status, std::string *body, const std::string &err)> ResponseCallback;
+    /**
+     * @brief 批量发起的一次异步调用，参数含义与 CallAsync 相同
+     */
+    struct OutgoingCall {
+        uint64_t request_id;
+        std::string frame;
+        int timeout_ms;
+        ResponseCallback cb;
+    };
+
+    /**
+     * @param ip   服务端 ip
+     * @param port 服务端端口
+     * @param loop 负责该连接的事件循环
+     */
+    KrpcClientConnection(const std::string &ip, uint16_t port, muduo::net::EventLoop *loop);
+    /**
+     * @brief 析构函数 在事件循环中关闭连接
+     */
+    ~KrpcClientConnection();
+    /**
+     * @brief 开始非阻塞地建立连接，构造完成后必须调用一次
+     * @param timeout_ms 超过该时间仍未建立连接时，连接上的所有调用都以失败结束
+     */
+    void Start(int timeout_ms);
+    /**
+     * @brief 生成该连接上唯一的请求 id
+     */
+    uint64_t NextRequestId();
+    /**
+     * @brief 在该连接上发起一次异步调用
+     * @details 立即返回，收到响应、超时或连接出错时执行 cb，cb 一定会被执行一次。
+     *          超时由事件循环的定时器触发，连接还没建立时也从调用发起时开始计时
+     */
+    void CallAsync(uint64_t request_id, const std::string &frame, int timeout_ms, const ResponseCallback &cb);
+    /**
+     * @brief 在该连接上连续发起多次异步调用
+     * @details 所有请求帧拼接在一起交给连接一次发送，通常只需要一次系统调用，
+     *          调用方不必等待前一个响应就可以发出下一个请求；每个调用的行为与 CallAsync 相同
+     * @param calls 要发起的调用，其中的请求帧和回调会被取走
+     */
+    void CallAsyncBatch(std::vector<OutgoingCall> *calls);
+    /**
+     * @brief 取消一次尚未完成的调用，可以在任意线程中调用
+     * @details 立即以 "rpc canceled" 结束该调用并释放它在连接上占用的位置；
+     *          请求已经发出时再向服务端发送取消帧，请求还在等待连接建立时直接丢弃
+     */
+    void Cancel(uint64_t request_id);
+    /**
+     * @brief 连接是否已经出错，出错的连接不能再使用
+     */
+    bool IsBroken();
+    /**
+     * @brief 服务端地址 "ip:port"
+     */
+    const std::string &Key() const { return m_key; }
+    /**
+     * @brief 将请求编码为一个完整的请求帧 { header_size(varint32), RpcHeader, args }
+     * @param header  请求头，参数长度由这里填写
+     * @param request 请求参数
+     * @param frame   输出参数，编码好的请求帧
+     */
+    static void EncodeRequest(Krpc::RpcHeader *header, const google::protobuf::Message *request,
+                              std::string *frame);
+    /**
+     * @brief 将请求编码为一个完整的请求帧，请求参数已经序列化好
+     * @param args 序列化好的请求参数
+     */
+    static void EncodeRequest(Krpc::RpcHeader *header, const std::string &args, std::string *frame);
+    /**
+     * @brief 从读缓冲区中解码一个响应帧，解码成功时从缓冲区中移除该帧
+     * @param status 解码成功时为服务端带回的调用状态
+     * @param err    解码成功时为服务端带回的错误信息，数据格式错误时为错误原因
+     * @return 1 解码成功，0 数据不完整，-1 数据格式错误
+     */
+    static int DecodeFrame(muduo::net::Buffer *buffer, uint64_t *request_id, int *status,
+                           std::string *body, std::string *err);
+
+private:
+    /**
+     * @brief 一次等待响应的调用
+     */
+    struct PendingCall {
+        ResponseCallback cb;
+        /// 超时定时器，has_timer 为 false 时无效
+        muduo::net::TimerId timer;
+        bool has_timer;
+    };
+
+    KrpcClientConnection(const KrpcClientConnection &) = delete;
+    KrpcClientConnection& operator=(const KrpcClientConnection &) = delete;
+
+    /**
+     * @brief 登记一次等待响应的调用并启动超时定时器，调用方必须持有 m_mutex
+     */
+    void AddPendingLocked(uint64_t request_id, int timeout_ms, const ResponseCallback &cb);
+    /**
+     * @brief 连接建立或断开，在事件循环线程中执行
+     */
+    void OnConnection(const muduo::net::TcpConnectionPtr &conn);
+    /**
+     * @brief 收到数据，分发其中所有完整的响应帧，在事件循环线程中执行
+     */
+    void OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer);
+    /**
+     * @brief 建立连接超时
+     */
+    void OnConnectTimeout();
+    /**
+     * @brief 调用超时，结束该调用并释放它在连接上占用的位置
+     */
+    void OnCallTimeout(uint64_t request_id);
+    /**
+     * @brief 连接出错，关闭连接，所有等待中的调用都以失败结束
+     * @param status 失败的调用状态 Krpc::RpcStatus
+     */
+    void FailAll(int status, const std::string &err);
+
+private:
+    std::string m_key;
+    muduo::net::EventLoop *m_loop;
+    /// 只能在事件循环线程中析构，析构时交给事件循环释放
+    std::unique_ptr<muduo::net::TcpClient> m_client;
+    std::atomic<uint64_t> m_nextId;
+    /// 保护以下成员
+    std::mutex m_mutex;
+    /// 已建立的连接，建立之前为空
+    muduo::net::TcpConnectionPtr m_conn;
+    /// 连接建立之前发起的调用的请求帧 <request_id, 请求帧>
+    std::vector<std::pair<uint64_t, std::string>> m_queued;
+    /// 等待响应的调用 <request_id, 调用>
+    std::unordered_map<uint64_t, PendingCall> m_pending;
+    /// 连接是否已经出错
+    bool m_broken;
+};
+
+
+#endif //KRPC_KRPC_CLIENTCONNECTION_H
@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ClientReactor.h
+  * @author         : 18483
+  * @brief          : 客户端事件循环
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_CLIENTREACTOR_H
+#define KRPC_KRPC_CLIENTREACTOR_H
+
+#include <muduo/net/EventLoop.h>
+#include <muduo/net/EventLoopThread.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief 进程级的客户端事件循环组
+ * @details 所有出站连接都由这里的事件循环负责：非阻塞建立连接、发送请求、读取响应，
+ *          读到的响应按 request_id 分发，同步调用由此唤醒等待的线程，异步调用直接在事件循环线程中执行完成回调。
+ *          事件循环线程数由配置项 client_io_threads 指定，新连接按轮询分配到各个事件循环上
+ */
+class KrpcClientReactor {
+public:
+    /**
+     * @brief 获取全局唯一的客户端事件循环组，第一次调用时启动事件循环线程
+     */
+    static KrpcClientReactor& GetInstance();
+    /**
+     * @brief 为新连接选择一个事件循环，可以在任意线程中调用
+     */
+    muduo::net::EventLoop *GetNextLoop();
+
+private:
+    KrpcClientReactor();
+    KrpcClientReactor(const KrpcClientReactor &) = delete;
+    KrpcClientReactor& operator=(const KrpcClientReactor &) = delete;
+
+private:
+    std::vector<std::unique_ptr<muduo::net::EventLoopThread>> m_threads;
+    std::vector<muduo::net::EventLoop*> m_loops;
+    std::atomic<size_t> m_next;
+};
+
+
+#endif //KRPC_KRPC_CLIENTREACTOR_H
@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ConnectionPool.h
+  * @author         : 18483
+  * @brief          : 客户端长连接池
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_CONNECTIONPOOL_H
+#define KRPC_KRPC_CONNECTIONPOOL_H
+
+#include "Krpc_ClientConnection.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief 进程级的客户端连接池
+ * @details 按 "ip:port" 维护到各个服务端的 TCP 长连接，调用结束后归还连接而不是关闭，
+ *          避免每次 RPC 都经历一次 TCP 握手并产生大量 TIME_WAIT。
+ *          连接支持多路复用，同一条连接可以同时承载多个在途请求
+ */
+class KrpcConnectionPool {
+public:
+    /**
+     * @brief 获取全局唯一的连接池
+     */
+    static KrpcConnectionPool& GetInstance();
+    /**
+     * @brief 从连接池中取出一个到 ip:port 的可用连接
+     * @details 选择在途请求最少的连接；
+     *          所有连接的在途请求都达到上限且连接数未达上限时新建连接
+     *          新连接在客户端事件循环中非阻塞地建立，不会阻塞调用线程
+     * @return 连接，失败返回 nullptr
+     */
+    std::shared_ptr<KrpcClientConnection> Acquire(const std::string &ip, uint16_t port);
+    /**
+     * @brief 调用结束后归还连接
+     * @details 出错的连接直接丢弃；空闲连接数超过上限时关闭多余的连接
+     */
+    void Release(const std::shared_ptr<KrpcClientConnection> &conn);
+    /**
+     * @brief 到 ip:port 的所有连接上的在途请求总数，供负载均衡参考
+     */
+    size_t InFlight(const std::string &ip, uint16_t port);
+
+private:
+    /**
+     * @brief 连接池中的一条连接
+     */
+    struct Slot {
+        std::shared_ptr<KrpcClientConnection> conn;
+        /// 该连接上的在途请求数
+        size_t inflight;
+    };
+    /**
+     * @brief 单个服务端地址对应的连接信息
+     */
+    struct Endpoint {
+        std::vector<Slot> slots;
+    };
+
+    KrpcConnectionPool();
+    KrpcConnectionPool(const KrpcConnectionPool &) = delete;
+    KrpcConnectionPool& operator=(const KrpcConnectionPool &) = delete;
+
+    /**
+     * @brief 选出在途请求最少的连接
+     */
+    static Slot *LeastLoaded(std::vector<Slot> &slots);
+
+private:
+    std::mutex m_mutex;
+    /// <"ip:port", 连接信息>
+    std::unordered_map<std::string, Endpoint> m_endpoints;
+    /// 每个地址最多保留的空闲连接（没有在途请求）数
+    size_t m_maxIdle;
+    /// 每个地址最多同时存在的连接数
+    size_t m_maxActive;
+    /// 单条连接上的在途请求数达到该值后，优先新建连接分担请求
+    size_t m_maxInflight;
+    /// 建立连接的超时时间
+    int m_connectTimeoutMs;
+};
+
+
+#endif //KRPC_KRPC_CONNECTIONPOOL_H
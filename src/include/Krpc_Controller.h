@@ -13,11 +13,15 @@
 #define KRPC_KRPC_CONTROLLER_H
 
 #include <google/protobuf/service.h>
+#include <functional>
+#include <mutex>
 #include <string>
 
 /**
  * @brief 用于描述 RPC 调用的控制器
- * @details 跟踪 RPC 方法调用的状态、错误信息 并 提供控制功能(如取消调用)
+ * @details 跟踪 RPC 方法调用的状态、错误信息 并 提供控制功能(如取消调用)。
+ *          客户端：StartCancel 中止正在进行的调用，释放它在连接上占用的位置，并通知服务端取消；
+ *          服务端：收到取消通知后 IsCanceled 返回 true，并执行 NotifyOnCancel 注册的回调
  */
 class KrpcController : public google::protobuf::RpcController {
 public:
@@ -37,21 +41,78 @@ public:
      * @brief 获取错误信息
      */
     std::string ErrorText() const;
+    /**
+     * @brief 获取错误码，取值见 Krpc::RpcStatus，调用成功时为 RPC_OK
+     */
+    int ErrorCode() const;
     /**
      * @brief 设置RPC调用失败，并记录失败原因
+     * @details 错误码为 RPC_SERVICE_ERROR，服务方法报告的错误会连同原因一起带回客户端
      */
     void SetFailed(const std::string &reason);
+    /**
+     * @brief 设置RPC调用失败，并记录错误码和失败原因
+     */
+    void SetFailed(int code, const std::string &reason);
+    /**
+     * @brief 设置本次调用的超时时间（毫秒），包括建立连接、发送请求和等待响应，0 表示使用配置项 rpc_timeout_ms
+     */
+    void SetTimeout(int timeout_ms);
+    /**
+     * @brief 获取本次调用的超时时间（毫秒）
+     */
+    int GetTimeout() const;
 
-    /// 未实现
+    /**
+     * @brief 客户端取消调用，可以在任意线程中调用
+     * @details 调用以 "rpc canceled" 失败结束（异步调用照常执行 done），服务端会收到取消通知
+     */
     void StartCancel();
+    /**
+     * @brief 服务端判断调用是否已被客户端取消（客户端断开连接也视为取消）
+     */
     bool IsCanceled() const;
+    /**
+     * @brief 服务端注册取消回调
+     * @details 回调只执行一次：调用被取消时立即执行，否则在调用完成（done->Run()）后执行；
+     *          注册时已经被取消则在当前线程中立即执行
+     */
     void NotifyOnCancel(google::protobuf::Closure* callback);
 
+    /**
+     * @brief 框架内部使用：设置客户端调用进行期间 StartCancel 要执行的动作，调用结束后设置为空
+     * @details 已经被取消时立即在当前线程中执行 hook
+     */
+    void SetCancelHook(const std::function<void()> &hook);
+    /**
+     * @brief 框架内部使用：取出 NotifyOnCancel 注册的回调，由调用方在不持有锁的情况下执行
+     * @param cancel 是否同时把调用标记为已取消
+     */
+    google::protobuf::Closure* TakeCancelCallback(bool cancel);
+    /**
+     * @brief 框架内部使用：以错误码和原因结束一次客户端调用，done 不为空时执行 done
+     * @details controller 是 KrpcController 时记录错误码，否则只记录原因
+     * @param code 错误码 Krpc::RpcStatus
+     */
+    static void FailCall(google::protobuf::RpcController *controller, google::protobuf::Closure *done,
+                         int code, const std::string &reason);
+
 private:
     /// RPC 方法执行过程中的状态
     bool m_failed;
     /// RPC 方法执行过程中的错误信息
     std::string m_errText;
+    /// 错误码 Krpc::RpcStatus
+    int m_errCode;
+    /// 调用的超时时间（毫秒），0 表示未设置
+    int m_timeoutMs;
+    /// 保护取消相关的成员，StartCancel 可能与调用在不同的线程中
+    mutable std::mutex m_cancelMutex;
+    bool m_canceled;
+    /// NotifyOnCancel 注册的回调
+    google::protobuf::Closure* m_cancelCallback;
+    /// 客户端取消调用的动作
+    std::function<void()> m_cancelHook;
 };
 
 
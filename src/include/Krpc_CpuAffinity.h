@@ -0,0 +1,35 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_CpuAffinity.h
+  * @author         : 18483
+  * @brief          : 线程 CPU 亲和性设置
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_CPUAFFINITY_H
+#define KRPC_KRPC_CPUAFFINITY_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief 线程绑核工具
+ */
+class KrpcCpuAffinity {
+public:
+    /**
+     * @brief 解析 CPU 列表，格式与 taskset -c 相同，例如 "0-3,8,10-11"
+     * @return 格式错误时返回 false
+     */
+    static bool ParseCpuList(const std::string &text, std::vector<int> *cpus);
+    /**
+     * @brief 把当前线程绑定到 cpus 中的第 index % cpus.size() 个 CPU 上，cpus 为空时不做任何事情
+     */
+    static void PinCurrentThread(const std::vector<int> &cpus, size_t index);
+};
+
+
+#endif //KRPC_KRPC_CPUAFFINITY_H
@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_Executor.h
+  * @author         : 18483
+  * @brief          : 服务端执行服务方法的执行器接口
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_EXECUTOR_H
+#define KRPC_KRPC_EXECUTOR_H
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * @brief 执行器接口
+ * @details KrpcProvider 把解析好的请求交给执行器执行服务方法，具体实现：
+ *          KrpcThreadPool 共享一个有界队列；KrpcWorkStealingPool 每个工作线程一个队列，空闲时从其他线程窃取任务
+ */
+class KrpcExecutor {
+public:
+    typedef std::function<void()> Task;
+    /// 工作线程启动时在该线程中执行，参数为工作线程下标，可用于绑核
+    typedef std::function<void(size_t index)> ThreadInitCallback;
+
+    virtual ~KrpcExecutor() {}
+    /**
+     * @brief 提交任务，队列已满时不阻塞
+     * @param task 任务
+     * @param hint 亲和性提示，相同 hint 的任务优先由同一个工作线程执行，实现可以忽略
+     * @return 队列已满时返回 false，任务不会被执行
+     */
+    virtual bool TrySubmit(const Task &task, size_t hint) = 0;
+    /**
+     * @brief 工作线程数
+     */
+    virtual size_t ThreadNum() const = 0;
+};
+
+
+#endif //KRPC_KRPC_EXECUTOR_H
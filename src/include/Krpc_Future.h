@@ -0,0 +1,203 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_Future.h
+  * @author         : 18483
+  * @brief          : 异步调用的结果句柄
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_FUTURE_H
+#define KRPC_KRPC_FUTURE_H
+
+#include "Krpc_Controller.h"
+#include <google/protobuf/service.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+template <typename Response>
+class KrpcFuture;
+
+/**
+ * @brief 通过生成的 Stub 方法在任意 RpcChannel 上发起异步调用，立即返回结果句柄
+ * @details 例如 KrpcCallAsync(&channel, &Kuser::UserServiceRpc_Stub::Login, request)。
+ *          KrpcChannel、KrpcPipeline 和 KrpcBatch 的 CallAsync 都转发到这里，
+ *          请求何时发出由 channel 决定
+ * @param channel    发起调用的 RpcChannel
+ * @param method     Stub 的方法
+ * @param request    请求参数
+ * @param timeout_ms 超时时间（毫秒），0 表示使用配置项 rpc_timeout_ms
+ */
+template <typename Stub, typename Request, typename Response>
+KrpcFuture<Response> KrpcCallAsync(google::protobuf::RpcChannel *channel,
+                                   void (Stub::*method)(google::protobuf::RpcController *, const Request *,
+                                                        Response *, google::protobuf::Closure *),
+                                   const Request &request, int timeout_ms = 0);
+
+/**
+ * @brief 一次异步 RPC 调用的结果，用法与 std::future 类似
+ * @details 由 KrpcCallAsync 或 KrpcChannel、KrpcPipeline、KrpcBatch 的 CallAsync 返回，可以复制，所有副本共享同一个结果。
+ *          调用在客户端事件循环中完成，不占用额外的线程；
+ *          wait / wait_for / get 会阻塞当前线程，不能在事件循环线程（例如 then 的回调）中调用
+ */
+template <typename Response>
+class KrpcFuture {
+public:
+    /// 调用结束后执行的回调，调用失败时 controller.Failed() 为 true
+    typedef std::function<void(const KrpcController &controller, const Response &response)> Continuation;
+
+    KrpcFuture() {}
+
+    /**
+     * @brief 是否关联了一次调用
+     */
+    bool valid() const { return m_state != nullptr; }
+    /**
+     * @brief 阻塞等待调用结束
+     */
+    void wait() const {
+        std::unique_lock<std::mutex> lock(m_state->mutex);
+        m_state->cv.wait(lock, [this] { return m_state->done; });
+    }
+    /**
+     * @brief 最多等待 timeout，返回 std::future_status::ready 或 std::future_status::timeout
+     */
+    template <typename Rep, typename Period>
+    std::future_status wait_for(const std::chrono::duration<Rep, Period> &timeout) const {
+        std::unique_lock<std::mutex> lock(m_state->mutex);
+        bool done = m_state->cv.wait_for(lock, timeout, [this] { return m_state->done; });
+        return done ? std::future_status::ready : std::future_status::timeout;
+    }
+    /**
+     * @brief 等待调用结束并返回响应，调用失败时响应内容无意义，需要先检查 Failed()
+     */
+    const Response &get() const {
+        wait();
+        return m_state->response;
+    }
+    /**
+     * @brief 等待调用结束，返回调用是否失败
+     */
+    bool Failed() const {
+        wait();
+        return m_state->controller.Failed();
+    }
+    /**
+     * @brief 等待调用结束，返回失败原因
+     */
+    std::string ErrorText() const {
+        wait();
+        return m_state->controller.ErrorText();
+    }
+    /**
+     * @brief 等待调用结束，返回错误码 Krpc::RpcStatus
+     */
+    int ErrorCode() const {
+        wait();
+        return m_state->controller.ErrorCode();
+    }
+    /**
+     * @brief 取消调用，调用以 "rpc canceled" 失败结束，服务端会收到取消通知
+     */
+    void cancel() const {
+        m_state->controller.StartCancel();
+    }
+    /**
+     * @brief 注册调用结束后执行的回调
+     * @details 调用尚未结束时，回调在客户端事件循环线程中执行，不能阻塞；
+     *          调用已经结束时，回调在当前线程中立即执行。可以注册多个回调，按注册顺序执行
+     */
+    void then(const Continuation &continuation) const {
+        {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            if(!m_state->done) {
+                m_state->continuations.push_back(continuation);
+                return;
+            }
+        }
+        continuation(m_state->controller, m_state->response);
+    }
+
+private:
+    template <typename Stub, typename Request, typename R>
+    friend KrpcFuture<R> KrpcCallAsync(google::protobuf::RpcChannel *channel,
+                                       void (Stub::*method)(google::protobuf::RpcController *, const Request *,
+                                                            R *, google::protobuf::Closure *),
+                                       const Request &request, int timeout_ms);
+
+    /**
+     * @brief 调用方与 Channel 共享的调用状态
+     */
+    struct State {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool done = false;
+        KrpcController controller;
+        Response response;
+        std::vector<Continuation> continuations;
+
+        /**
+         * @brief 调用结束：唤醒等待的线程并执行已注册的回调
+         */
+        void Complete() {
+            std::vector<Continuation> pending;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                done = true;
+                pending.swap(continuations);
+                cv.notify_all();
+            }
+            for(auto &continuation : pending) {
+                continuation(controller, response);
+            }
+        }
+    };
+
+    /**
+     * @brief 作为 CallMethod 的 done 传入，调用结束后完成 State 并释放自己
+     */
+    class Completion : public google::protobuf::Closure {
+    public:
+        explicit Completion(const std::shared_ptr<State> &state) : m_state(state) {}
+        void Run() override {
+            m_state->Complete();
+            delete this;
+        }
+
+    private:
+        std::shared_ptr<State> m_state;
+    };
+
+    explicit KrpcFuture(const std::shared_ptr<State> &state) : m_state(state) {}
+
+private:
+    std::shared_ptr<State> m_state;
+};
+
+/**
+ * @brief KrpcCallAsync 的实现
+ */
+template <typename Stub, typename Request, typename Response>
+KrpcFuture<Response> KrpcCallAsync(google::protobuf::RpcChannel *channel,
+                                   void (Stub::*method)(google::protobuf::RpcController *, const Request *,
+                                                        Response *, google::protobuf::Closure *),
+                                   const Request &request, int timeout_ms) {
+    typedef typename KrpcFuture<Response>::State State;
+    typedef typename KrpcFuture<Response>::Completion Completion;
+    std::shared_ptr<State> state = std::make_shared<State>();
+    state->controller.SetTimeout(timeout_ms);
+    // 生成的 Stub 不持有 Channel，只是把调用转发给 CallMethod，构造它的开销可以忽略
+    Stub stub(channel);
+    (stub.*method)(&state->controller, &request, &state->response, new Completion(state));
+    return KrpcFuture<Response>(state);
+}
+
+#endif //KRPC_KRPC_FUTURE_H
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_LoadBalancer.h
+  * @author         : 18483
+  * @brief          : 客户端负载均衡策略
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_LOADBALANCER_H
+#define KRPC_KRPC_LOADBALANCER_H
+
+#include "Krpc_ServiceDiscovery.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 负载均衡策略接口
+ * @details 从服务的多个实例中选出本次调用使用的实例，实现需要是线程安全的
+ */
+class KrpcLoadBalancer {
+public:
+    virtual ~KrpcLoadBalancer() {}
+    /**
+     * @brief 选出一个实例
+     * @param instances 服务的实例列表，不为空
+     */
+    virtual const KrpcServiceInstance &Select(const std::vector<KrpcServiceInstance> &instances) = 0;
+    /**
+     * @brief 根据策略名创建负载均衡策略
+     * @param policy "roundrobin" / "random" / "p2c"，未知的策略名使用轮询
+     */
+    static std::shared_ptr<KrpcLoadBalancer> Create(const std::string &policy);
+    /**
+     * @brief 进程默认的负载均衡策略，由配置项 loadbalance 指定
+     */
+    static std::shared_ptr<KrpcLoadBalancer> Default();
+};
+
+/**
+ * @brief 轮询
+ */
+class KrpcRoundRobinBalancer : public KrpcLoadBalancer {
+public:
+    KrpcRoundRobinBalancer() : m_next(0) {}
+    const KrpcServiceInstance &Select(const std::vector<KrpcServiceInstance> &instances) override;
+
+private:
+    std::atomic<size_t> m_next;
+};
+
+/**
+ * @brief 加权随机，实例被选中的概率与权重成正比
+ */
+class KrpcWeightedRandomBalancer : public KrpcLoadBalancer {
+public:
+    const KrpcServiceInstance &Select(const std::vector<KrpcServiceInstance> &instances) override;
+};
+
+/**
+ * @brief 二选一 (power of two choices)
+ * @details 随机选出两个实例，取连接池中在途请求较少（按权重折算）的那个。
+ *          在途请求多的实例通常是处理得慢的实例，比单纯轮询更能避开慢节点
+ */
+class KrpcP2CBalancer : public KrpcLoadBalancer {
+public:
+    const KrpcServiceInstance &Select(const std::vector<KrpcServiceInstance> &instances) override;
+};
+
+
+#endif //KRPC_KRPC_LOADBALANCER_H
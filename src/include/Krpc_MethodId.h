@@ -0,0 +1,33 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_MethodId.h
+  * @author         : 18483
+  * @brief          : RPC 方法的数字 id
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_METHODID_H
+#define KRPC_KRPC_METHODID_H
+
+#include <google/protobuf/descriptor.h>
+#include <cstdint>
+
+/**
+ * @brief 计算 RPC 方法的数字 id
+ * @details id 是方法全名（package.Service.Method）的 32 位 FNV-1a 哈希，
+ *          客户端和服务端各自计算，不需要额外同步；请求头中只携带 id，不再携带服务名和方法名。
+ *          0 保留给不带 id 的请求，服务端注册时检查冲突
+ */
+class KrpcMethodId {
+public:
+    /**
+     * @brief 方法的数字 id，不会为 0；每个方法只计算一次，可以在任意线程中调用
+     */
+    static uint32_t Of(const google::protobuf::MethodDescriptor *method);
+};
+
+
+#endif //KRPC_KRPC_METHODID_H
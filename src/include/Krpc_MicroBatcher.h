@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_MicroBatcher.h
+  * @author         : 18483
+  * @brief          : 客户端自动攒批
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_MICROBATCHER_H
+#define KRPC_KRPC_MICROBATCHER_H
+
+#include "Krpc_Batch.h"
+#include "Krpc_ClientConnection.h"
+#include "Krpc_Controller.h"
+#include <google/protobuf/service.h>
+#include <muduo/net/EventLoop.h>
+#include <muduo/net/TimerId.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief 进程级的自动攒批器，把发往同一服务端实例的调用合并成批量请求
+ * @details 按 "ip:port" 为每个服务端实例维护一个攒批窗口，进程内所有 KrpcChannel、所有线程发往该实例的调用
+ *          都加入同一个窗口。第一个调用到达时从连接池取出一条连接、开启窗口，并在客户端事件循环中注册 linger 定时器；
+ *          定时器到期 或 调用数达到 max_batch 时整体发送，批量响应到达后再拆分给各个调用。
+ *          服务发现、选择实例和获取连接都由调用线程在加入窗口前完成，定时器中只编码请求头并交给连接发送，
+ *          事件循环线程中不会访问 ZooKeeper。
+ *          每个调用保留自己的截止时间和取消：到期时由自己的定时器以 RPC_TIMEOUT 结束，StartCancel 时立即以 RPC_CANCELED 结束，
+ *          不影响同一窗口中的其他调用；批量请求按其中最晚的截止时间发给服务端
+ */
+class KrpcMicroBatcher {
+public:
+    /**
+     * @brief 获取全局唯一的攒批器
+     */
+    static KrpcMicroBatcher& GetInstance();
+    /**
+     * @brief 加入一个异步调用，可以在任意线程中调用
+     * @details 调用方已经选好服务端实例并确认请求参数完整，其余参数与 KrpcChannel::CallMethod 相同
+     * @param ip         服务端 ip
+     * @param port       服务端端口
+     * @param timeout_ms 本次调用的超时时间（毫秒），0 表示不限时
+     * @param linger_us  开启新窗口时窗口的长度（微秒）
+     * @param max_batch  窗口内的调用数达到该值时立即发送
+     */
+    void Add(const std::string &ip, uint16_t port,
+             const google::protobuf::MethodDescriptor *method,
+             google::protobuf::RpcController *controller,
+             const google::protobuf::Message *request,
+             google::protobuf::Message *response,
+             google::protobuf::Closure *done,
+             int timeout_ms, int linger_us, size_t max_batch);
+
+private:
+    /**
+     * @brief 窗口中的一个调用
+     * @details 批量响应、自己的超时定时器 和 取消 三者中最先到达的一个结束调用，之后到达的被忽略
+     */
+    struct Call {
+        KrpcBatch::Entry entry;
+        /// 调用的控制器，不是 KrpcController 时为空
+        KrpcController *controller;
+        uint32_t method_id;
+        /// 已经序列化好的请求参数，发送时取走
+        std::string args;
+        /// 调用的截止时间，has_deadline 为 false 时不限时
+        std::chrono::steady_clock::time_point deadline;
+        bool has_deadline;
+        /// 保护 loop 和 timer，调用可能在定时器注册完成之前就被取消
+        std::mutex mutex;
+        /// 超时定时器所在的事件循环，还没有注册定时器时为空
+        muduo::net::EventLoop *loop;
+        muduo::net::TimerId timer;
+        /// 调用是否已经结束
+        std::atomic<bool> finished;
+    };
+    /**
+     * @brief 发往一个服务端实例的攒批窗口
+     */
+    struct Window {
+        /// 窗口编号，用于识别过期的定时器
+        uint64_t id;
+        /// 开启窗口时取出的连接，批量请求结束后归还
+        std::shared_ptr<KrpcClientConnection> conn;
+        /// 窗口内的调用
+        std::vector<std::shared_ptr<Call>> calls;
+    };
+
+    KrpcMicroBatcher();
+    KrpcMicroBatcher(const KrpcMicroBatcher &) = delete;
+    KrpcMicroBatcher& operator=(const KrpcMicroBatcher &) = delete;
+
+    /**
+     * @brief linger 定时器到期，在客户端事件循环线程中执行，窗口还是注册定时器时的那个窗口时发送
+     */
+    void OnLinger(const std::string &key, uint64_t id);
+    /**
+     * @brief 发送一个已经关闭的窗口，不持有锁时调用
+     * @details 发送前已经结束的调用不再发给服务端，已经到期的调用以 RPC_TIMEOUT 结束
+     */
+    static void Send(std::unique_ptr<Window> window);
+    /**
+     * @brief 结束一个调用并执行它的 done，调用已经结束时什么也不做，不持有锁时调用
+     * @param from_timer 是否由调用自己的超时定时器触发，此时不需要再取消定时器
+     * @param result     批量响应中该调用的结果，参见 KrpcBatch::CompleteEntry
+     */
+    static void Finish(const std::shared_ptr<Call> &call, int status, const std::string &err,
+                       const Krpc::RpcBatchResult *result, bool from_timer);
+
+private:
+    /// 保护以下成员
+    std::mutex m_mutex;
+    /// <"ip:port", 正在攒批的窗口>
+    std::unordered_map<std::string, std::unique_ptr<Window>> m_windows;
+    /// 下一个窗口的编号
+    uint64_t m_nextId;
+};
+
+
+#endif //KRPC_KRPC_MICROBATCHER_H
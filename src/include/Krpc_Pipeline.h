@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_Pipeline.h
+  * @author         : 18483
+  * @brief          : 客户端请求流水线
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_PIPELINE_H
+#define KRPC_KRPC_PIPELINE_H
+
+#include "Krpc_Channel.h"
+#include "Krpc_ClientConnection.h"
+#include "Krpc_Controller.h"
+#include "Krpc_Future.h"
+#include <google/protobuf/service.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 把多个异步调用攒在一起发送的 RpcChannel
+ * @details 通过 pipeline 发起的异步调用先在调用线程中序列化好请求参数并暂存，Flush 时编码请求头，同一连接上的
+ *          所有请求帧拼接在一起一次发出，连续的小请求不再各自触发一次系统调用，
+ *          也不需要等前一个响应返回再发下一个请求；响应仍按 request_id 匹配，完成顺序不保证与发送顺序一致。
+ *          同步调用（done 为空）会先发送已暂存的请求，再按普通方式完成。
+ *          用法：KrpcPipeline pipeline(&channel); 多次 pipeline.CallAsync(...); pipeline.Flush();
+ *          pipeline 只能在一个线程中使用，析构时发送所有未发送的请求
+ */
+class KrpcPipeline : public google::protobuf::RpcChannel {
+public:
+    /**
+     * @param channel   实际完成服务发现、负载均衡和编码的 Channel，生命周期必须长于 pipeline
+     * @param max_batch 暂存的请求数达到该值时自动 Flush，0 表示只在显式调用 Flush 时发送
+     */
+    explicit KrpcPipeline(KrpcChannel *channel, size_t max_batch = 0);
+    /**
+     * @brief 析构函数 发送所有未发送的请求
+     */
+    virtual ~KrpcPipeline();
+    /**
+     * @brief 发起调用，异步调用暂存到 Flush 时发送，参数与 KrpcChannel::CallMethod 相同
+     */
+    void CallMethod(const ::google::protobuf::MethodDescriptor * method,
+                    ::google::protobuf::RpcController * controller,
+                    const ::google::protobuf::Message * request,
+                    ::google::protobuf::Message * response,
+                    ::google::protobuf::Closure * done) override;
+    /**
+     * @brief 通过生成的 Stub 方法发起异步调用，用法与 KrpcChannel::CallAsync 相同，请求在 Flush 时发出
+     */
+    template <typename Stub, typename Request, typename Response>
+    KrpcFuture<Response> CallAsync(void (Stub::*method)(google::protobuf::RpcController *, const Request *,
+                                                        Response *, google::protobuf::Closure *),
+                                   const Request &request, int timeout_ms = 0) {
+        return KrpcCallAsync(this, method, request, timeout_ms);
+    }
+    /**
+     * @brief 发送所有暂存的请求，每条连接上的请求帧只发送一次
+     * @details 暂存期间已经取消的调用不再发送，在这里以 RPC_CANCELED 结束；已经超过截止时间的调用以 RPC_TIMEOUT 结束。
+     *          请求头中的超时时间和连接上的超时定时器都按发送时剩余的时间计算
+     */
+    void Flush();
+    /**
+     * @brief 暂存的请求数
+     */
+    size_t Pending() const { return m_pending; }
+
+private:
+    friend class KrpcChannel;
+
+    /**
+     * @brief 一个暂存的请求
+     */
+    struct Call {
+        /// 请求头，超时时间在 Flush 时填写
+        std::shared_ptr<Krpc::RpcHeader> header;
+        /// 序列化好的请求参数
+        std::string args;
+        /// 调用的截止时间，has_deadline 为 false 时不限时
+        std::chrono::steady_clock::time_point deadline;
+        bool has_deadline;
+        KrpcClientConnection::ResponseCallback cb;
+        /// 调用的控制器，不是 KrpcController 时为空，Flush 时据此跳过已经取消的调用
+        KrpcController *controller;
+    };
+    /**
+     * @brief 同一连接上暂存的请求
+     */
+    struct Batch {
+        std::shared_ptr<KrpcClientConnection> conn;
+        std::vector<Call> calls;
+    };
+
+    KrpcPipeline(const KrpcPipeline &) = delete;
+    KrpcPipeline& operator=(const KrpcPipeline &) = delete;
+
+    /**
+     * @brief 暂存一个请求，由 KrpcChannel 调用
+     * @param header       请求头，已经填好方法 id 和请求 id
+     * @param args         序列化好的请求参数，内容会被取走
+     * @param has_deadline 调用是否限时
+     * @param deadline     调用的截止时间
+     * @param controller   调用的控制器，可以为空
+     */
+    void Enqueue(const std::shared_ptr<KrpcClientConnection> &conn, const Krpc::RpcHeader &header,
+                 std::string *args, bool has_deadline, std::chrono::steady_clock::time_point deadline,
+                 const KrpcClientConnection::ResponseCallback &cb, KrpcController *controller);
+
+private:
+    KrpcChannel *m_channel;
+    size_t m_maxBatch;
+    /// 按连接分组的暂存请求，连接数通常很少，顺序查找即可
+    std::vector<Batch> m_batches;
+    size_t m_pending;
+};
+
+
+#endif //KRPC_KRPC_PIPELINE_H
@@ -14,14 +14,27 @@
 
 #include "google/protobuf/service.h"
 #include "zookeeperUtil.h"
+#include "Krpc_Controller.h"
+#include "Krpc_Executor.h"
+#include <atomic>
+#include <muduo/net/Buffer.h>
 #include <muduo/net/TcpServer.h>
 #include <muduo/net/EventLoop.h>
 #include <muduo/net/InetAddress.h>
 #include <muduo/net/TcpConnection.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/arena.h>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+namespace Krpc {
+class RpcHeader;
+class RpcResponseHeader;
+}
 
 class KrpcProvider {
 public:
@@ -38,6 +51,19 @@ public:
      * @brief 启动RPC服务节点，开始提供RPC远程网络调用服务
      */
     void Run();
+    /**
+     * @brief 从输入数据的开头解码一个请求帧的头部
+     * @details 请求帧格式 { header_size(varint32), RpcHeader, args }，只解析头部，参数留给调用方按方法类型解析
+     * @param data        输入数据
+     * @param readable    输入数据的长度
+     * @param header      输出参数，解码成功时为请求头
+     * @param args_offset 输出参数，解码成功时为请求参数相对 data 的偏移
+     * @param frame_size  输出参数，解码成功时为整个请求帧的长度
+     * @param err         输出参数，数据格式错误时为错误原因
+     * @return 1 解码成功，0 数据不完整，-1 数据格式错误
+     */
+    static int DecodeRequestFrame(const char* data, size_t readable, Krpc::RpcHeader* header,
+                                  size_t* args_offset, size_t* frame_size, std::string* err);
 private:
     /**
      * @brief 服务信息结构体 存储服务对象和方法map
@@ -50,6 +76,81 @@ private:
         std::unordered_map<std::string, const google::protobuf::MethodDescriptor*> method_map;
     };
 
+    /**
+     * @brief 方法分发表中的一项
+     * @details 请求和响应的原型在注册时取好，处理请求时不再调用服务的虚函数
+     */
+    struct MethodEntry{
+        // 方法 id，见 KrpcMethodId
+        uint32_t id;
+        google::protobuf::Service* service;
+        const google::protobuf::MethodDescriptor* method;
+        const google::protobuf::Message* request_prototype;
+        const google::protobuf::Message* response_prototype;
+    };
+
+    /**
+     * @brief 一次批量请求的状态，定义在实现文件中
+     */
+    struct BatchCall;
+
+    /**
+     * @brief 一次 RPC 调用的上下文
+     * @details 同一连接上可能同时有多个请求在处理，响应需要带回请求 id 供客户端匹配。
+     *          request/response 及其所有子字段都从上下文自带的 Arena 中分配，响应发送后整体释放；
+     *          上下文本身就是传给服务方法的 done 回调，不再为每次调用单独 new 一个 Closure
+     */
+    struct CallContext : public google::protobuf::Closure{
+        CallContext();
+        // done->Run() 时发送响应并回收上下文
+        void Run() override;
+
+        KrpcProvider* provider;
+        // 要调用的服务对象和方法
+        google::protobuf::Service* service;
+        const google::protobuf::MethodDescriptor* method;
+        // 请求所在的连接
+        muduo::net::TcpConnectionPtr conn;
+        // 传给服务方法的控制器，客户端取消调用时被标记为已取消
+        KrpcController controller;
+        // 请求 id，在响应头中原样带回
+        uint64_t request_id;
+        // 所属的批量请求，不是批量请求中的调用时为空；此时结果写入批量响应的第 batch_index 项
+        BatchCall* batch;
+        int batch_index;
+        // 客户端放弃等待的时间，之后再处理或发送响应都没有意义；请求不限时时无效
+        muduo::Timestamp deadline;
+        // 服务端请求 从 arena 分配
+        google::protobuf::Message* request;
+        // 服务端响应 从 arena 分配
+        google::protobuf::Message* response;
+        // Arena 的初始内存块，Reset 后仍保留，上下文复用时小请求不需要再申请内存
+        char initial_block[4096];
+        google::protobuf::Arena arena;
+    };
+    /**
+     * @brief 每条连接的状态，保存在 TcpConnection 的 context 中
+     * @details 服务方法可能在其他线程中执行 done，访问正在处理的请求需要加锁；
+     *          响应只在连接所在的 IO 线程中产生，output 和 flush_pending 只在该线程中访问，不需要加锁
+     */
+    struct ConnectionState{
+        std::mutex mutex;
+        // 该连接上正在处理的请求 <request_id, 调用上下文>，用于处理客户端的取消帧；
+        // 批量请求中的调用都登记在批量请求的 request_id 下
+        std::unordered_multimap<uint64_t, CallContext*> inflight;
+        // 本轮事件循环中产生、尚未发出的响应帧
+        muduo::net::Buffer output;
+        // 是否已经安排在本轮事件循环结束时发送 output
+        bool flush_pending = false;
+    };
+    /**
+     * @brief 每个线程缓存的空闲调用上下文，线程退出时释放
+     */
+    struct CallContextCache{
+        ~CallContextCache();
+        std::vector<CallContext*> contexts;
+    };
+
     /**
      * @brief 连接回调函数 处理客户端连接事件
      * @param conn
@@ -64,17 +165,117 @@ private:
     void OnMessage(const muduo::net::TcpConnectionPtr& conn,
                    muduo::net::Buffer* buffer, muduo::Timestamp receive_time);
     /**
-     * @brief 响应回调函数 发送 PRC 响应给客户端
+     * @brief 处理一个完整的请求帧
      * @param conn
-     * @param response
+     * @param krpcHeader 已解析的请求头
+     * @param args 指向输入缓冲区中的请求参数，长度为 krpcHeader.args_size()，只在本次调用内有效
+     * @param receive_time 收到请求的时间，与请求头中的剩余超时时间一起确定截止时间
+     */
+    void HandleRequest(const muduo::net::TcpConnectionPtr& conn,
+                       const Krpc::RpcHeader& krpcHeader, const char* args, muduo::Timestamp receive_time);
+    /**
+     * @brief 处理一个批量请求帧，其中的每个调用各自派发，全部结束后发送一个响应帧
+     * @param args 指向输入缓冲区中的 RpcBatchRequest，只在本次调用内有效
+     */
+    void HandleBatch(const muduo::net::TcpConnectionPtr& conn,
+                     const Krpc::RpcHeader& krpcHeader, const char* args, muduo::Timestamp receive_time);
+    /**
+     * @brief 把已经解析好请求参数的调用交给业务线程池 或 在当前 IO 线程中执行
+     */
+    void DispatchCall(CallContext* ctx);
+    /**
+     * @brief 按请求头查找要调用的方法
+     * @details 请求头带有方法 id 时在分发表中二分查找；不带 id 时按服务名和方法名查找
+     * @return 未注册的方法返回 nullptr
+     */
+    const MethodEntry* FindMethod(const Krpc::RpcHeader& krpcHeader) const;
+    /**
+     * @brief 按方法 id 在分发表中二分查找
+     */
+    const MethodEntry* FindMethod(uint32_t method_id) const;
+    /**
+     * @brief 当前 IO 线程提交任务时的亲和性提示
+     * @details 工作线程按 IO 线程分组，每个 IO 线程的请求轮流交给自己组内的工作线程，
+     *          同一 IO 线程上的请求集中在少数几个工作线程上执行，其余工作线程空闲时再来窃取
+     */
+    size_t AffinityHint();
+    /**
+     * @brief 执行服务方法，在业务线程池 或 IO 线程中执行
+     * @details 请求在排队期间已经过期或被取消时不再执行服务方法，直接结束调用
+     */
+    void InvokeMethod(CallContext* ctx);
+    /**
+     * @brief 处理取消帧，标记对应请求的控制器为已取消；取消批量请求时标记其中的所有调用
+     */
+    void HandleCancel(const muduo::net::TcpConnectionPtr& conn, uint64_t request_id);
+    /**
+     * @brief 调用已经完成，从连接的正在处理的请求中移除，之后不能再被取消
+     */
+    static void RemoveInflight(CallContext* ctx);
+    /**
+     * @brief 获取连接的状态，连接建立时创建
+     */
+    static ConnectionState* GetConnectionState(const muduo::net::TcpConnectionPtr& conn);
+    /**
+     * @brief 把一个响应帧 { header_size(varint32), RpcResponseHeader, body } 追加到连接的待发送缓冲区
+     * @details 响应先攒在连接的缓冲区中，第一个响应安排一次 FlushOutput，之后的响应随它一起发出：
+     *          处理输入时产生的响应在本轮事件处理结束时发出，业务线程交回 IO 线程的一批完成在这批 pending functor
+     *          执行完之后发出，多路复用 或 流水线的负载下，多个响应只需要一次 write 系统调用。
+     *          只能在连接所在的 IO 线程中调用
+     * @param body 响应消息体，调用失败时为空
+     */
+    static void SendResponseFrame(const muduo::net::TcpConnectionPtr& conn, Krpc::RpcResponseHeader* header,
+                                  const google::protobuf::Message* body);
+    /**
+     * @brief 发送框架错误，客户端收到后立即以 status（Krpc::RpcStatus）失败结束调用，不必等到超时
+     */
+    static void SendErrorResponse(const muduo::net::TcpConnectionPtr& conn, uint64_t request_id,
+                                  int status, const std::string& error_text);
+    /**
+     * @brief 发送连接上攒下的所有响应帧，在事件循环本轮处理结束时执行
+     */
+    static void FlushOutput(const muduo::net::TcpConnectionPtr& conn);
+    /**
+     * @brief 响应回调函数 发送 PRC 响应给客户端
+     * @param ctx 调用上下文，发送后释放
+     */
+    void SendRpcResponse(CallContext* ctx);
+    /**
+     * @brief 批量请求中的一个调用结束，把结果写入批量响应
+     */
+    void FinishBatchEntry(CallContext* ctx);
+    /**
+     * @brief 批量请求中的调用数减一，全部结束时发送批量响应并释放
+     */
+    void FinishBatchCall(BatchCall* batch);
+    /**
+     * @brief 获取一个调用上下文，优先复用当前线程缓存的上下文
+     */
+    CallContext* NewCallContext();
+    /**
+     * @brief 回收调用上下文，释放 arena 中的 request/response
+     */
+    void ReleaseCallContext(CallContext* ctx);
+    /**
+     * @brief 当前线程的调用上下文缓存
      */
-    void SendRpcResponse(const muduo::net::TcpConnectionPtr& conn, google::protobuf::Message* response);
+    static CallContextCache& LocalContextCache();
 
 private:
     /// 事件循环
     muduo::net::EventLoop event_loop;
     /// 服务map 保存服务对象和 服务信息  <service_name, service_info>
     std::unordered_map<std::string, ServiceInfo> service_map;
+    /// 方法分发表，按方法 id 升序排列
+    std::vector<MethodEntry> method_table;
+    /// 每个线程最多缓存的空闲调用上下文数量，0 表示不复用
+    size_t arena_cache_size = 64;
+    /// 业务线程池，未配置 worker_threads 时为空，服务方法直接在 IO 线程中执行
+    std::unique_ptr<KrpcExecutor> worker_pool;
+    /// IO 线程数
+    int io_thread_num = 4;
+    /// 给 IO 线程编号，用于绑核和计算提交任务时的亲和性提示
+    std::atomic<size_t> io_thread_counter{0};
 };
 
 /*
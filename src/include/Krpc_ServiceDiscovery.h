@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ServiceDiscovery.h
+  * @author         : 18483
+  * @brief          : 客户端服务发现缓存
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_SERVICEDISCOVERY_H
+#define KRPC_KRPC_SERVICEDISCOVERY_H
+
+#include "zookeeperUtil.h"
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief 一个服务端实例
+ */
+struct KrpcServiceInstance {
+    std::string ip;
+    uint16_t port;
+    /// 权重，用于加权负载均衡，至少为 1
+    int weight;
+};
+
+/// 服务端实例列表，缓存中的列表不可修改，查询方可以在缓存失效后继续安全地使用
+typedef std::shared_ptr<const std::vector<KrpcServiceInstance>> KrpcInstanceList;
+
+/**
+ * @brief 进程级的服务发现缓存
+ * @details 每个服务端在 "/service" 下注册一个临时顺序节点 "/service/instance-xxxxxxxxxx"，
+ *          节点数据为 "ip:port:weight"，同一服务可以有多个服务端实例。
+ *          整个进程共用一个 ZooKeeper 会话，服务的实例列表第一次查询后缓存在内存中，
+ *          同时通过 zoo_wget_children 注册 watcher。实例上线或下线时由后台刷新线程重新获取实例列表，
+ *          刷新完成前查询方继续使用旧列表，之后的查询都只是一次内存查找，不会因为 watcher 触发而阻塞在 ZooKeeper 上
+ */
+class KrpcServiceDiscovery {
+public:
+    /**
+     * @brief 获取全局唯一的服务发现对象
+     */
+    static KrpcServiceDiscovery& GetInstance();
+    /**
+     * @brief 析构函数 停止后台刷新线程
+     */
+    ~KrpcServiceDiscovery();
+    /**
+     * @brief 查询提供服务的全部服务端实例
+     * @return 实例列表，服务不存在或没有可用实例时返回 nullptr
+     */
+    KrpcInstanceList GetInstances(const std::string &service_name);
+
+private:
+    KrpcServiceDiscovery();
+    KrpcServiceDiscovery(const KrpcServiceDiscovery &) = delete;
+    KrpcServiceDiscovery& operator=(const KrpcServiceDiscovery &) = delete;
+
+    /**
+     * @brief 缓存未命中时加载实例列表
+     * @details 持有 m_zkMutex 后再查一次缓存，同一服务同时未命中的多个调用方只有第一个会查询 ZooKeeper
+     */
+    KrpcInstanceList Load(const std::string &path);
+    /**
+     * @brief 从 ZooKeeper 查询实例列表并注册 watcher，调用方需持有 m_zkMutex
+     */
+    KrpcInstanceList Query(const std::string &path);
+    /**
+     * @brief 解析实例节点数据 "ip:port:weight"，weight 可以省略
+     */
+    static bool ParseInstance(const std::string &data, KrpcServiceInstance *instance);
+    /**
+     * @brief 节点 watcher，在 ZooKeeper 的回调线程中执行
+     * @details 回调线程中不能调用同步的 ZooKeeper 接口，这里只把要刷新的路径交给后台刷新线程
+     */
+    static void Watcher(zhandle_t *zh, int type, int state, const char *path, void *watcherCtx);
+    /**
+     * @brief 安排后台刷新 path 对应的实例列表
+     */
+    void ScheduleRefresh(const std::string &path);
+    /**
+     * @brief 会话过期，所有 watcher 都已失效，安排重建会话并刷新全部缓存
+     */
+    void ScheduleRefreshAll();
+    /**
+     * @brief 后台刷新线程，重新查询 watcher 通知的服务并替换缓存
+     */
+    void RefreshLoop();
+
+private:
+    /// 保护 m_cache、m_refreshPaths、m_expired 和 m_stop
+    std::mutex m_mutex;
+    /// <"/service", 服务端实例列表>
+    std::unordered_map<std::string, KrpcInstanceList> m_cache;
+    /// 串行化对 ZooKeeper 的访问和缓存的写入，watcher 中不会获取
+    std::mutex m_zkMutex;
+    std::unique_ptr<ZkClient> m_zkclient;
+    /// 会话是否已经过期
+    bool m_expired;
+    /// 等待后台刷新的服务路径
+    std::unordered_set<std::string> m_refreshPaths;
+    /// 有新的刷新任务 或 需要停止刷新线程时通知
+    std::condition_variable m_refreshCond;
+    /// 是否停止刷新线程
+    bool m_stop;
+    /// 后台刷新线程，在第一次建立 ZooKeeper 会话时启动
+    std::thread m_refresher;
+};
+
+
+#endif //KRPC_KRPC_SERVICEDISCOVERY_H
@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_ThreadPool.h
+  * @author         : 18483
+  * @brief          : 服务端业务线程池
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_THREADPOOL_H
+#define KRPC_KRPC_THREADPOOL_H
+
+#include "Krpc_Executor.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 固定线程数、有界队列的线程池
+ * @details 队列满时 TrySubmit 直接返回 false 而不是阻塞，由提交方决定如何处理（例如在当前线程中执行），
+ *          IO 线程提交任务时不会因为业务线程繁忙而被卡住
+ */
+class KrpcThreadPool : public KrpcExecutor {
+public:
+    /**
+     * @param thread_num     工作线程数
+     * @param max_queue_size 队列中最多等待的任务数
+     * @param init_callback  工作线程启动时执行
+     */
+    KrpcThreadPool(int thread_num, size_t max_queue_size,
+                   const ThreadInitCallback &init_callback = ThreadInitCallback());
+    /**
+     * @brief 析构函数 执行完队列中剩余的任务后退出所有工作线程
+     */
+    ~KrpcThreadPool();
+    /**
+     * @brief 提交任务，所有工作线程共享一个队列，忽略 hint
+     * @return 队列已满时返回 false，任务不会被执行
+     */
+    bool TrySubmit(const Task &task, size_t hint) override;
+    /**
+     * @brief 工作线程数
+     */
+    size_t ThreadNum() const override { return m_threads.size(); }
+
+private:
+    KrpcThreadPool(const KrpcThreadPool &) = delete;
+    KrpcThreadPool& operator=(const KrpcThreadPool &) = delete;
+
+    /**
+     * @brief 工作线程 循环取出任务执行
+     */
+    void WorkerLoop(size_t index);
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Task> m_queue;
+    size_t m_maxQueueSize;
+    bool m_stopping;
+    ThreadInitCallback m_initCallback;
+    std::vector<std::thread> m_threads;
+};
+
+
+#endif //KRPC_KRPC_THREADPOOL_H
@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file           : Krpc_WorkStealingPool.h
+  * @author         : 18483
+  * @brief          : 工作窃取线程池
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#ifndef KRPC_KRPC_WORKSTEALINGPOOL_H
+#define KRPC_KRPC_WORKSTEALINGPOOL_H
+
+#include "Krpc_Executor.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 工作窃取线程池
+ * @details 每个工作线程有自己的双端队列，各自加锁，提交和取任务不会争用同一把锁：
+ *          外部线程按 hint 把任务放进对应工作线程的队列尾部；工作线程自己提交的任务放进自己的队列；
+ *          工作线程从自己队列的尾部取任务（LIFO，缓存更热），自己的队列为空时从其他线程队列的头部窃取（FIFO，最早的任务）。
+ *          所有队列都为空时工作线程休眠，有新任务时才唤醒
+ */
+class KrpcWorkStealingPool : public KrpcExecutor {
+public:
+    /**
+     * @param thread_num  工作线程数
+     * @param max_pending 所有队列中最多等待的任务数
+     * @param init_callback 工作线程启动时执行
+     */
+    KrpcWorkStealingPool(int thread_num, size_t max_pending,
+                         const ThreadInitCallback &init_callback = ThreadInitCallback());
+    /**
+     * @brief 析构函数 执行完所有剩余的任务后退出工作线程
+     */
+    ~KrpcWorkStealingPool();
+    /**
+     * @brief 提交任务
+     * @param hint 外部线程提交时，任务放进第 hint % 线程数 个工作线程的队列
+     */
+    bool TrySubmit(const Task &task, size_t hint) override;
+    /**
+     * @brief 工作线程数
+     */
+    size_t ThreadNum() const override { return m_workers.size(); }
+
+private:
+    /**
+     * @brief 单个工作线程的任务队列
+     */
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    KrpcWorkStealingPool(const KrpcWorkStealingPool &) = delete;
+    KrpcWorkStealingPool& operator=(const KrpcWorkStealingPool &) = delete;
+
+    /**
+     * @brief 工作线程 循环取任务执行
+     */
+    void WorkerLoop(size_t index);
+    /**
+     * @brief 从自己队列的尾部取任务
+     */
+    bool PopLocal(size_t index, Task *task);
+    /**
+     * @brief 从其他工作线程队列的头部窃取任务
+     */
+    bool Steal(size_t index, Task *task);
+
+private:
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    ThreadInitCallback m_initCallback;
+    std::vector<std::thread> m_threads;
+    /// 已提交但还没有被取走的任务数
+    std::atomic<size_t> m_pending;
+    size_t m_maxPending;
+    /// 休眠中的工作线程数，只有存在休眠的线程时提交任务才需要加锁唤醒
+    std::atomic<int> m_sleeping;
+    std::mutex m_parkMutex;
+    std::condition_variable m_parkCv;
+    std::atomic<bool> m_stopping;
+};
+
+
+#endif //KRPC_KRPC_WORKSTEALINGPOOL_H
@@ -14,6 +14,7 @@
 #include <semaphore.h>
 #include <zookeeper/zookeeper.h>
 #include <string>
+#include <vector>
 
 
 /**
@@ -29,12 +30,22 @@ public:
     void Start();
     /**
      * @brief 在 zkserver 中根据指定的 path 创建一个节点
+     * @details state 含 ZOO_SEQUENCE 时，实际创建的节点名会在 path 后追加递增序号
      */
     void Create(const char* path, const char* data, int datalen, int state = 0);
     /**
      * @brief 根据节点路径获取 znode 节点值
      */
     std::string GetData(const char* path);
+    /**
+     * @brief 根据节点路径获取 znode 节点值，并注册一次性 watcher，节点变化或删除时回调通知
+     */
+    std::string GetData(const char* path, watcher_fn watcher, void* watcherCtx);
+    /**
+     * @brief 获取 path 下的所有子节点名，并注册一次性 watcher，子节点增删时回调通知
+     * @param ok 输出参数 是否获取成功
+     */
+    std::vector<std::string> GetChildren(const char* path, watcher_fn watcher, void* watcherCtx, bool* ok);
 private:
     /// zk 的客户端句柄
     zhandle_t* m_zhandle;
@@ -28,6 +28,10 @@ void global_watcher(zhandle_t* zh, int type, int status, const char* path, void*
         if(status == ZOO_CONNECTED_STATE) {
             std::lock_guard<std::mutex> lock(cv_mutex);  // 加锁保护
             is_connected = true;  // 标记连接成功
+        } else if(status == ZOO_EXPIRED_SESSION_STATE) {
+            // 会话过期 句柄已不可用，之后重新 Start 的客户端需要重新等待连接成功
+            std::lock_guard<std::mutex> lock(cv_mutex);
+            is_connected = false;
         }
     }
     cv.notify_all();   // 通知所有等待的线程
@@ -81,14 +85,17 @@ void ZkClient::Start() {
 void ZkClient::Create(const char *path, const char *data, int datalen, int state) {
     char path_buffer[128];   // 用于存储创建的节点路径
     int bufferlen = sizeof(path_buffer);
-    // 检查节点是否已经存在
-    int flag = zoo_exists(m_zhandle, path, 0, nullptr);
+    // 检查节点是否已经存在，顺序节点每次创建的节点名都不同，不需要检查
+    int flag = (state & ZOO_SEQUENCE) ? ZNONODE : zoo_exists(m_zhandle, path, 0, nullptr);
     if (flag == ZNONODE) {  // 节点不存在
         // 创建指定的 ZooKeeper 节点
         flag = zoo_create(m_zhandle, path, data, datalen,
                           &ZOO_OPEN_ACL_UNSAFE, state, path_buffer, bufferlen);
         if(flag == ZOK) {   // 节点创建成功
-            LOG(INFO) << "znode create success ... path: " << path;
+            LOG(INFO) << "znode create success ... path: " << path_buffer;
+        } else if(flag == ZNODEEXISTS) {
+            // 多个服务端同时启动时，永久节点可能已经被其他服务端抢先创建
+            LOG(INFO) << "znode already exists ... path: " << path;
         } else {
             LOG(ERROR) << "znode create failed ... path: " << path;
             exit(EXIT_FAILURE); // 退出程序
@@ -113,4 +120,38 @@ std::string ZkClient::GetData(const char *path) {
     return "";        // 默认返回空字符串
 }
 
+/**
+ * @brief 获取 zookeeper 节点的数据 并注册 watcher
+ * @details watcher 是一次性的，触发后需要重新调用本函数注册
+ */
+std::string ZkClient::GetData(const char *path, watcher_fn watcher, void *watcherCtx) {
+    char buf[64];  // 用于存储节点数据
+    int bufferlen = sizeof(buf);
+    int flag = zoo_wget(m_zhandle, path, watcher, watcherCtx, buf, &bufferlen, nullptr);
+    if(flag != ZOK || bufferlen < 0) {
+        LOG(ERROR) << "zoo_wget error: " << path;
+        return "";    // 获取失败返回空字符串
+    }
+    return std::string(buf, bufferlen);
+}
 
+/**
+ * @brief 获取子节点列表 并注册 watcher
+ * @details watcher 是一次性的，触发后需要重新调用本函数注册
+ */
+std::vector<std::string> ZkClient::GetChildren(const char *path, watcher_fn watcher, void *watcherCtx, bool *ok) {
+    std::vector<std::string> children;
+    struct String_vector strings;
+    int flag = zoo_wget_children(m_zhandle, path, watcher, watcherCtx, &strings);
+    if(flag != ZOK) {
+        LOG(ERROR) << "zoo_wget_children error: " << path;
+        *ok = false;
+        return children;
+    }
+    for(int i = 0; i < strings.count; ++i) {
+        children.push_back(strings.data[i]);
+    }
+    deallocate_String_vector(&strings);
+    *ok = true;
+    return children;
+}
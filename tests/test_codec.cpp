@@ -0,0 +1,210 @@
+/**
+  ******************************************************************************
+  * @file           : test_codec.cpp
+  * @author         : 18483
+  * @brief          : 请求帧和响应帧解码测试
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#include "../src/include/Krpc_Provider.h"
+#include "../src/include/Krpc_ClientConnection.h"
+#include "../src/Krpcheader.pb.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <muduo/net/Buffer.h>
+#include <cstdio>
+#include <string>
+
+static int g_failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if(!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++g_failures; \
+        } \
+    } while(0)
+
+/**
+ * @brief varint32 编码的长度
+ */
+static std::string Varint(uint32_t value) {
+    uint8_t bytes[5];
+    uint8_t *end = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(value, bytes);
+    return std::string(reinterpret_cast<const char*>(bytes), end - bytes);
+}
+
+/**
+ * @brief 编码请求帧 { header_size(varint32), RpcHeader, args }
+ */
+static std::string RequestFrame(uint64_t request_id, const std::string &args) {
+    Krpc::RpcHeader header;
+    header.set_method_id(0x12345678);
+    header.set_request_id(request_id);
+    header.set_args_size(static_cast<uint32_t>(args.size()));
+    std::string header_str = header.SerializeAsString();
+    return Varint(static_cast<uint32_t>(header_str.size())) + header_str + args;
+}
+
+/**
+ * @brief 编码响应帧 { header_size(varint32), RpcResponseHeader, body }
+ */
+static std::string ResponseFrame(uint64_t request_id, int status, const std::string &error_text,
+                                 const std::string &body) {
+    Krpc::RpcResponseHeader header;
+    header.set_request_id(request_id);
+    header.set_status(static_cast<Krpc::RpcStatus>(status));
+    header.set_error_text(error_text);
+    header.set_body_size(static_cast<uint32_t>(body.size()));
+    std::string header_str = header.SerializeAsString();
+    return Varint(static_cast<uint32_t>(header_str.size())) + header_str + body;
+}
+
+static int DecodeRequest(const std::string &data, Krpc::RpcHeader *header, size_t *args_offset,
+                         size_t *frame_size) {
+    std::string err;
+    return KrpcProvider::DecodeRequestFrame(data.data(), data.size(), header, args_offset, frame_size, &err);
+}
+
+/**
+ * @brief 请求帧：完整、不完整、连续多个 和 长度字段过大的情况
+ */
+static void TestRequestDecoder() {
+    std::string frame = RequestFrame(7, "hello");
+    Krpc::RpcHeader header;
+    size_t args_offset = 0;
+    size_t frame_size = 0;
+
+    CHECK(DecodeRequest(frame, &header, &args_offset, &frame_size) == 1);
+    CHECK(header.request_id() == 7);
+    CHECK(header.method_id() == 0x12345678);
+    CHECK(frame_size == frame.size());
+    CHECK(frame.substr(args_offset, header.args_size()) == "hello");
+
+    // 任意长度的前缀都只是数据不完整
+    for(size_t len = 0; len < frame.size(); ++len) {
+        CHECK(DecodeRequest(frame.substr(0, len), &header, &args_offset, &frame_size) == 0);
+    }
+
+    // 连续的两个请求帧逐个解码
+    std::string second = RequestFrame(8, std::string(300, 'x'));
+    std::string both = frame + second;
+    CHECK(DecodeRequest(both, &header, &args_offset, &frame_size) == 1);
+    CHECK(header.request_id() == 7);
+    std::string rest = both.substr(frame_size);
+    CHECK(DecodeRequest(rest, &header, &args_offset, &frame_size) == 1);
+    CHECK(header.request_id() == 8);
+    CHECK(frame_size == rest.size());
+    CHECK(rest.substr(args_offset) == std::string(300, 'x'));
+
+    // 头部长度过大时不等待数据收全，立即报错
+    CHECK(DecodeRequest(Varint(1u << 30), &header, &args_offset, &frame_size) == -1);
+    CHECK(DecodeRequest(Varint(64 * 1024), &header, &args_offset, &frame_size) == -1);
+    // 参数长度过大
+    Krpc::RpcHeader big;
+    big.set_request_id(9);
+    big.set_args_size(0xffffffffu);
+    std::string big_str = big.SerializeAsString();
+    CHECK(DecodeRequest(Varint(static_cast<uint32_t>(big_str.size())) + big_str,
+                        &header, &args_offset, &frame_size) == -1);
+    // 超过 5 个字节的 varint
+    CHECK(DecodeRequest(std::string(6, '\xff'), &header, &args_offset, &frame_size) == -1);
+}
+
+/**
+ * @brief 响应帧：逐字节到达、连续多个 和 长度字段过大的情况
+ */
+static void TestResponseDecoder() {
+    uint64_t request_id = 0;
+    int status = -1;
+    std::string body;
+    std::string err;
+
+    // 逐字节追加，最后一个字节到达之前都是数据不完整
+    std::string frame = ResponseFrame(1, Krpc::RPC_OK, "", "response body");
+    muduo::net::Buffer buffer;
+    for(size_t i = 0; i < frame.size(); ++i) {
+        CHECK(KrpcClientConnection::DecodeFrame(&buffer, &request_id, &status, &body, &err) == 0);
+        buffer.append(frame.data() + i, 1);
+    }
+    CHECK(KrpcClientConnection::DecodeFrame(&buffer, &request_id, &status, &body, &err) == 1);
+    CHECK(request_id == 1);
+    CHECK(status == Krpc::RPC_OK);
+    CHECK(body == "response body");
+    CHECK(buffer.readableBytes() == 0);
+
+    // 连续的成功响应和失败响应
+    std::string both = ResponseFrame(2, Krpc::RPC_OK, "", std::string(1000, 'y'))
+                       + ResponseFrame(3, Krpc::RPC_METHOD_NOT_FOUND, "no such method", "");
+    buffer.append(both.data(), both.size());
+    CHECK(KrpcClientConnection::DecodeFrame(&buffer, &request_id, &status, &body, &err) == 1);
+    CHECK(request_id == 2);
+    CHECK(status == Krpc::RPC_OK);
+    CHECK(body == std::string(1000, 'y'));
+    CHECK(KrpcClientConnection::DecodeFrame(&buffer, &request_id, &status, &body, &err) == 1);
+    CHECK(request_id == 3);
+    CHECK(status == Krpc::RPC_METHOD_NOT_FOUND);
+    CHECK(err == "no such method");
+    CHECK(buffer.readableBytes() == 0);
+    CHECK(KrpcClientConnection::DecodeFrame(&buffer, &request_id, &status, &body, &err) == 0);
+
+    // 头部长度过大
+    muduo::net::Buffer oversized_header;
+    std::string varint = Varint(1u << 30);
+    oversized_header.append(varint.data(), varint.size());
+    CHECK(KrpcClientConnection::DecodeFrame(&oversized_header, &request_id, &status, &body, &err) == -1);
+
+    // 消息体长度过大
+    Krpc::RpcResponseHeader big;
+    big.set_request_id(4);
+    big.set_body_size(0xffffffffu);
+    std::string big_str = big.SerializeAsString();
+    std::string big_frame = Varint(static_cast<uint32_t>(big_str.size())) + big_str;
+    muduo::net::Buffer oversized_body;
+    oversized_body.append(big_frame.data(), big_frame.size());
+    CHECK(KrpcClientConnection::DecodeFrame(&oversized_body, &request_id, &status, &body, &err) == -1);
+}
+
+/**
+ * @brief 用序列化好的参数编码的请求帧与直接编码请求消息的结果相同，并且可以解码
+ */
+static void TestRequestEncoder() {
+    Krpc::RpcHeader args_message;
+    args_message.set_request_id(42);
+    args_message.set_method_id(7);
+    std::string args = args_message.SerializeAsString();
+
+    Krpc::RpcHeader header;
+    header.set_method_id(0x12345678);
+    header.set_request_id(11);
+    header.set_timeout_ms(250);
+    Krpc::RpcHeader header_copy = header;
+    std::string from_message;
+    std::string from_args;
+    KrpcClientConnection::EncodeRequest(&header, &args_message, &from_message);
+    KrpcClientConnection::EncodeRequest(&header_copy, args, &from_args);
+    CHECK(from_message == from_args);
+
+    Krpc::RpcHeader decoded;
+    size_t args_offset = 0;
+    size_t frame_size = 0;
+    CHECK(DecodeRequest(from_args, &decoded, &args_offset, &frame_size) == 1);
+    CHECK(decoded.request_id() == 11);
+    CHECK(decoded.timeout_ms() == 250);
+    CHECK(frame_size == from_args.size());
+    CHECK(from_args.substr(args_offset) == args);
+}
+
+int main() {
+    TestRequestDecoder();
+    TestRequestEncoder();
+    TestResponseDecoder();
+    if(g_failures != 0) {
+        fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file           : test_cpu_affinity.cpp
+  * @author         : 18483
+  * @brief          : CPU 列表解析测试
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#include "../src/include/Krpc_CpuAffinity.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static int g_failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if(!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++g_failures; \
+        } \
+    } while(0)
+
+/**
+ * @brief 解析成功且结果与 expected 相同
+ */
+static bool Accepts(const std::string &text, const std::vector<int> &expected) {
+    std::vector<int> cpus;
+    if(!KrpcCpuAffinity::ParseCpuList(text, &cpus)) {
+        fprintf(stderr, "rejected: \"%s\"\n", text.c_str());
+        return false;
+    }
+    return cpus == expected;
+}
+
+/**
+ * @brief 解析失败，并且不留下部分结果
+ */
+static bool Rejects(const std::string &text) {
+    std::vector<int> cpus(1, 42);
+    if(KrpcCpuAffinity::ParseCpuList(text, &cpus)) {
+        fprintf(stderr, "accepted: \"%s\"\n", text.c_str());
+        return false;
+    }
+    return cpus.empty();
+}
+
+int main() {
+    CHECK(Accepts("", std::vector<int>()));
+    CHECK(Accepts("0", std::vector<int>{0}));
+    CHECK(Accepts("3", std::vector<int>{3}));
+    CHECK(Accepts("0-3", std::vector<int>{0, 1, 2, 3}));
+    CHECK(Accepts("2-2", std::vector<int>{2}));
+    CHECK(Accepts("0-1,4,6-7", std::vector<int>{0, 1, 4, 6, 7}));
+    // 空项被忽略
+    CHECK(Accepts("1,,2,", std::vector<int>{1, 2}));
+
+    CHECK(Rejects("a"));
+    CHECK(Rejects("1a"));
+    CHECK(Rejects("-1"));
+    CHECK(Rejects("+1"));
+    CHECK(Rejects(" 1"));
+    CHECK(Rejects("0-"));
+    CHECK(Rejects("-"));
+    CHECK(Rejects("3-1"));
+    CHECK(Rejects("1-2-3"));
+    CHECK(Rejects("0-1,x"));
+    CHECK(Rejects("100000"));
+
+    if(g_failures != 0) {
+        fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
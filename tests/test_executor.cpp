@@ -0,0 +1,234 @@
+/**
+  ******************************************************************************
+  * @file           : test_executor.cpp
+  * @author         : 18483
+  * @brief          : 业务线程池行为测试
+  * @attention      : None
+  * @date           : 2026/10/16
+  ******************************************************************************
+  */
+
+
+#include "../src/include/Krpc_ThreadPool.h"
+#include "../src/include/Krpc_WorkStealingPool.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static int g_failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if(!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++g_failures; \
+        } \
+    } while(0)
+
+/**
+ * @brief 等待 counter 达到 expected，最多等待 timeout_ms 毫秒
+ */
+static bool WaitFor(const std::atomic<int> &counter, int expected, int timeout_ms) {
+    std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while(counter.load() < expected) {
+        if(std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+/**
+ * @brief 多个外部线程提交的任务全部被执行，队列满时重试
+ */
+static void TestRunsEveryTask(KrpcExecutor *pool) {
+    const int kThreads = 4;
+    const int kTasksPerThread = 5000;
+    std::atomic<int> counter(0);
+    std::vector<std::thread> submitters;
+    for(int t = 0; t < kThreads; ++t) {
+        submitters.emplace_back([pool, &counter, t]() {
+            for(int i = 0; i < kTasksPerThread; ++i) {
+                while(!pool->TrySubmit([&counter]() { ++counter; }, static_cast<size_t>(t + i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for(auto &t : submitters) {
+        t.join();
+    }
+    CHECK(WaitFor(counter, kThreads * kTasksPerThread, 10000));
+}
+
+/**
+ * @brief 工作线程全部休眠后再提交的任务能及时唤醒工作线程
+ */
+static void TestWakesParkedWorkers(KrpcExecutor *pool) {
+    std::atomic<int> counter(0);
+    for(int round = 0; round < 20; ++round) {
+        // 让所有工作线程都进入休眠
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        CHECK(pool->TrySubmit([&counter]() { ++counter; }, static_cast<size_t>(round)));
+        CHECK(WaitFor(counter, round + 1, 1000));
+    }
+}
+
+/**
+ * @brief 任务中再提交的任务同样会被执行
+ */
+static void TestNestedSubmit(KrpcExecutor *pool) {
+    const int kTasks = 100;
+    std::atomic<int> counter(0);
+    for(int i = 0; i < kTasks; ++i) {
+        CHECK(pool->TrySubmit([pool, &counter, i]() {
+            while(!pool->TrySubmit([&counter]() { ++counter; }, static_cast<size_t>(i))) {
+                std::this_thread::yield();
+            }
+            ++counter;
+        }, static_cast<size_t>(i)));
+    }
+    CHECK(WaitFor(counter, 2 * kTasks, 10000));
+}
+
+/**
+ * @brief 等待中的任务数达到上限时拒绝新任务，有任务被取走后恢复接受
+ * @param pool 只有一个工作线程，最多等待 max_pending 个任务
+ */
+static void TestRejectsOverMaxPending(KrpcExecutor *pool, int max_pending) {
+    std::atomic<bool> started(false);
+    std::atomic<bool> release(false);
+    std::atomic<int> counter(0);
+    // 占住唯一的工作线程，之后提交的任务都只能排队
+    CHECK(pool->TrySubmit([&started, &release, &counter]() {
+        started = true;
+        while(!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ++counter;
+    }, 0));
+    while(!started) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for(int i = 0; i < max_pending; ++i) {
+        CHECK(pool->TrySubmit([&counter]() { ++counter; }, 0));
+    }
+    // 被拒绝的任务不会执行
+    CHECK(!pool->TrySubmit([&counter]() { counter += 1000; }, 0));
+    release = true;
+    CHECK(WaitFor(counter, max_pending + 1, 10000));
+    CHECK(pool->TrySubmit([&counter]() { ++counter; }, 0));
+    CHECK(WaitFor(counter, max_pending + 2, 10000));
+    CHECK(counter.load() == max_pending + 2);
+}
+
+/**
+ * @brief 析构时执行完所有已经接受的任务
+ */
+template<typename Pool>
+static void TestDrainsOnDestruction() {
+    std::atomic<int> counter(0);
+    int accepted = 0;
+    {
+        Pool pool(2, 1000);
+        for(int i = 0; i < 1000; ++i) {
+            if(pool.TrySubmit([&counter]() { ++counter; }, static_cast<size_t>(i))) {
+                ++accepted;
+            }
+        }
+    }
+    CHECK(accepted == 1000);
+    CHECK(counter.load() == accepted);
+}
+
+/**
+ * @brief 析构开始后任务中再提交的任务被拒绝，析构不会因此卡住
+ */
+template<typename Pool>
+static void TestNestedSubmitDuringDestruction() {
+    std::atomic<bool> started(false);
+    std::atomic<bool> deleting(false);
+    std::atomic<int> rejected(0);
+    std::atomic<int> nested(0);
+    std::atomic<int> destroyed(0);
+    Pool *pool = new Pool(2, 16);
+    CHECK(pool->TrySubmit([pool, &started, &deleting, &rejected, &nested]() {
+        started = true;
+        while(!deleting) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        // 等析构函数进入停止状态后再提交
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        for(int i = 0; i < 3; ++i) {
+            if(!pool->TrySubmit([&nested]() { ++nested; }, static_cast<size_t>(i))) {
+                ++rejected;
+            }
+        }
+    }, 0));
+    while(!started) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::thread deleter([pool, &deleting, &destroyed]() {
+        deleting = true;
+        delete pool;
+        ++destroyed;
+    });
+    if(!WaitFor(destroyed, 1, 5000)) {
+        fprintf(stderr, "pool destructor hung\n");
+        ++g_failures;
+        deleter.detach();
+        return;
+    }
+    deleter.join();
+    CHECK(rejected.load() == 3);
+    CHECK(nested.load() == 0);
+}
+
+/**
+ * @brief 每个工作线程启动时以自己的下标执行一次初始化回调
+ */
+template<typename Pool>
+static void TestInitCallback() {
+    std::atomic<int> mask(0);
+    {
+        Pool pool(3, 16, [&mask](size_t index) { mask |= 1 << index; });
+        std::atomic<int> counter(0);
+        CHECK(pool.TrySubmit([&counter]() { ++counter; }, 0));
+        CHECK(WaitFor(counter, 1, 1000));
+    }
+    CHECK(mask.load() == 7);
+}
+
+template<typename Pool>
+static void RunAll(const char *name) {
+    {
+        Pool pool(4, 1024);
+        TestRunsEveryTask(&pool);
+        TestWakesParkedWorkers(&pool);
+        TestNestedSubmit(&pool);
+    }
+    {
+        Pool pool(1, 8);
+        TestRejectsOverMaxPending(&pool, 8);
+    }
+    TestDrainsOnDestruction<Pool>();
+    TestNestedSubmitDuringDestruction<Pool>();
+    TestInitCallback<Pool>();
+    printf("%s done\n", name);
+}
+
+int main() {
+    RunAll<KrpcThreadPool>("KrpcThreadPool");
+    RunAll<KrpcWorkStealingPool>("KrpcWorkStealingPool");
+    if(g_failures != 0) {
+        fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}